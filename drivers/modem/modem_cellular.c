@@ -24,13 +24,11 @@ enum modem_cellular_state {
 	MODEM_CELLULAR_STATE_IDLE = 0,
 	MODEM_CELLULAR_STATE_RUN_INIT_SCRIPT,
 	MODEM_CELLULAR_STATE_CONNECT_CMUX,
-	MODEM_CELLULAR_STATE_OPEN_DLCI1,
-	MODEM_CELLULAR_STATE_OPEN_DLCI2,
+	MODEM_CELLULAR_STATE_OPEN_DLCIS,
 	MODEM_CELLULAR_STATE_RUN_DIAL_SCRIPT,
 	MODEM_CELLULAR_STATE_REGISTER,
 	MODEM_CELLULAR_STATE_ROAMING,
-	MODEM_CELLULAR_STATE_CLOSE_DLCI2,
-	MODEM_CELLULAR_STATE_CLOSE_DLCI1,
+	MODEM_CELLULAR_STATE_CLOSE_DLCIS,
 	MODEM_CELLULAR_STATE_DISCONNECT_CMUX,
 };
 
@@ -40,10 +38,8 @@ enum modem_cellular_event {
 	MODEM_CELLULAR_EVENT_SCRIPT_SUCCESS,
 	MODEM_CELLULAR_EVENT_SCRIPT_FAILED,
 	MODEM_CELLULAR_EVENT_CMUX_CONNECTED,
-	MODEM_CELLULAR_EVENT_DLCI1_OPENED,
-	MODEM_CELLULAR_EVENT_DLCI1_CLOSED,
-	MODEM_CELLULAR_EVENT_DLCI2_OPENED,
-	MODEM_CELLULAR_EVENT_DLCI2_CLOSED,
+	MODEM_CELLULAR_EVENT_DLCIS_OPENED,
+	MODEM_CELLULAR_EVENT_DLCIS_CLOSED,
 	MODEM_CELLULAR_EVENT_CMUX_DISCONNECTED,
 	MODEM_CELLULAR_EVENT_TIMEOUT,
 };
@@ -56,15 +52,11 @@ struct modem_cellular_data {
 	uint8_t uart_backend_transmit_buf[512];
 
 	/* CMUX */
-	struct modem_cmux cmux;
-	uint8_t cmux_receive_buf[128];
-	uint8_t cmux_transmit_buf[256];
-	struct modem_cmux_dlci dlci1;
-	struct modem_cmux_dlci dlci2;
+	struct modem_cmux *cmux;
+	struct modem_cmux_dlci *dlci1;
+	struct modem_cmux_dlci *dlci2;
 	struct modem_pipe *dlci1_pipe;
 	struct modem_pipe *dlci2_pipe;
-	uint8_t dlci1_receive_buf[128];
-	uint8_t dlci2_receive_buf[256];
 
 	/* Modem chat */
 	struct modem_chat chat;
@@ -102,13 +94,11 @@ static const char *modem_cellular_state_str[] = {
 	"idle",
 	"run init script",
 	"connect cmux",
-	"open dlci1",
-	"open dlci2",
+	"open dlcis",
 	"run dial script",
 	"register",
 	"roaming",
-	"close dlci2",
-	"close dlci1",
+	"close dlcis",
 	"disconnect cmux"
 };
 
@@ -118,10 +108,8 @@ static const char *modem_cellular_event_str[] = {
 	"script success",
 	"script failed",
 	"cmux connected",
-	"dlci1 opened",
-	"dlci1 closed",
-	"dlci2 opened",
-	"dlci2 closed",
+	"dlcis opened",
+	"dlcis closed",
 	"cmux disconnected",
 	"timeout"
 };
@@ -135,52 +123,6 @@ static void modem_cellular_delegate_event(struct modem_cellular_data *data,
 static void modem_cellular_event_handler(struct modem_cellular_data *data,
 					 enum modem_cellular_event evt);
 
-static void modem_cellular_dlci1_pipe_handler(struct modem_pipe *pipe,
-					      enum modem_pipe_event event,
-					      void *user_data)
-{
-	struct modem_cellular_data *data = (struct modem_cellular_data *)user_data;
-
-	switch (event)
-	{
-	case MODEM_PIPE_EVENT_OPENED:
-		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCI1_OPENED);
-
-		break;
-
-	case MODEM_PIPE_EVENT_CLOSED:
-		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCI1_CLOSED);
-
-		break;
-
-	default:
-		break;
-	}
-}
-
-static void modem_cellular_dlci2_pipe_handler(struct modem_pipe *pipe,
-					      enum modem_pipe_event event,
-					      void *user_data)
-{
-	struct modem_cellular_data *data = (struct modem_cellular_data *)user_data;
-
-	switch (event)
-	{
-	case MODEM_PIPE_EVENT_OPENED:
-		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCI2_OPENED);
-
-		break;
-
-	case MODEM_PIPE_EVENT_CLOSED:
-		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCI2_CLOSED);
-
-		break;
-
-	default:
-		break;
-	}
-}
-
 static void modem_cellular_chat_callback_handler(struct modem_chat *chat,
 						 enum modem_chat_script_result result,
 						 void *user_data)
@@ -416,11 +358,11 @@ static int modem_cellular_on_run_init_script_state_leave(struct modem_cellular_d
 
 static int modem_cellular_on_connect_cmux_state_enter(struct modem_cellular_data *data)
 {
-	if (modem_cmux_attach(&data->cmux, data->uart_pipe) < 0) {
+	if (modem_cmux_attach(data->cmux, data->uart_pipe) < 0) {
 		return -EAGAIN;
 	}
 
-	return modem_cmux_connect_async(&data->cmux);
+	return modem_cmux_connect_async(data->cmux);
 }
 
 static void modem_cellular_connect_cmux_event_handler(struct modem_cellular_data *data,
@@ -429,7 +371,7 @@ static void modem_cellular_connect_cmux_event_handler(struct modem_cellular_data
 	switch (evt)
 	{
 	case MODEM_CELLULAR_EVENT_CMUX_CONNECTED:
-		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_OPEN_DLCI1);
+		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_OPEN_DLCIS);
 
 		break;
 
@@ -438,49 +380,41 @@ static void modem_cellular_connect_cmux_event_handler(struct modem_cellular_data
 	}
 }
 
-static int modem_cellular_on_open_dlci1_state_enter(struct modem_cellular_data *data)
+static int modem_cellular_on_open_dlcis_state_enter(struct modem_cellular_data *data)
 {
-	modem_pipe_attach(data->dlci1_pipe, modem_cellular_dlci1_pipe_handler, data);
+	struct modem_cmux_dlci *const dlcis[] = {data->dlci1, data->dlci2};
 
-	return modem_pipe_open_async(data->dlci1_pipe);
+	return modem_cmux_dlcis_open_async(data->cmux, dlcis, ARRAY_SIZE(dlcis));
 }
 
-static void modem_cellular_open_dlci1_event_handler(struct modem_cellular_data *data,
+static bool modem_cellular_dlcis_are_open(struct modem_cellular_data *data)
+{
+	return (data->dlci1->state == MODEM_CMUX_DLCI_STATE_OPEN) &&
+	       (data->dlci2->state == MODEM_CMUX_DLCI_STATE_OPEN);
+}
+
+static void modem_cellular_open_dlcis_event_handler(struct modem_cellular_data *data,
 						    enum modem_cellular_event evt)
 {
 	switch (evt)
 	{
-	case MODEM_CELLULAR_EVENT_DLCI1_OPENED:
-		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_OPEN_DLCI2);
-
-		break;
-
-	default:
-		break;
-	}
-}
+	case MODEM_CELLULAR_EVENT_DLCIS_OPENED:
+		/* Raised once DLCIs are done opening, including those which failed to open */
+		if (modem_cellular_dlcis_are_open(data) == false) {
+			LOG_WRN("failed to open DLCIs");
 
-static int modem_cellular_on_open_dlci1_state_leave(struct modem_cellular_data *data)
-{
-	modem_pipe_release(data->dlci1_pipe);
+			/* Leave CMUX mode to run init script again */
+			modem_cmux_disconnect_async(data->cmux);
 
-	return 0;
-}
+			break;
+		}
 
-static int modem_cellular_on_open_dlci2_state_enter(struct modem_cellular_data *data)
-{
-	modem_pipe_attach(data->dlci2_pipe, modem_cellular_dlci2_pipe_handler, data);
+		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_RUN_DIAL_SCRIPT);
 
-	return modem_pipe_open_async(data->dlci2_pipe);
-}
+		break;
 
-static void modem_cellular_open_dlci2_event_handler(struct modem_cellular_data *data,
-						    enum modem_cellular_event evt)
-{
-	switch (evt)
-	{
-	case MODEM_CELLULAR_EVENT_DLCI2_OPENED:
-		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_RUN_DIAL_SCRIPT);
+	case MODEM_CELLULAR_EVENT_CMUX_DISCONNECTED:
+		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_RUN_INIT_SCRIPT);
 
 		break;
 
@@ -489,13 +423,6 @@ static void modem_cellular_open_dlci2_event_handler(struct modem_cellular_data *
 	}
 }
 
-static int modem_cellular_on_open_dlci2_state_leave(struct modem_cellular_data *data)
-{
-	modem_pipe_release(data->dlci2_pipe);
-
-	return 0;
-}
-
 static int modem_cellular_on_run_dial_script_state_enter(struct modem_cellular_data *data)
 {
 	if (modem_chat_attach(&data->chat, data->dlci2_pipe) < 0) {
@@ -595,7 +522,7 @@ static void modem_cellular_roaming_event_handler(struct modem_cellular_data *dat
 	switch (evt)
 	{
 	case MODEM_CELLULAR_EVENT_SUSPEND:
-		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_CLOSE_DLCI2);
+		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_CLOSE_DLCIS);
 
 		break;
 
@@ -629,41 +556,21 @@ static int modem_cellular_on_roaming_state_leave(struct modem_cellular_data *dat
 	return 0;
 }
 
-static int modem_cellular_on_close_dlci2_state_enter(struct modem_cellular_data *data)
+static int modem_cellular_on_close_dlcis_state_enter(struct modem_cellular_data *data)
 {
-	modem_pipe_close_async(data->dlci2_pipe);
+	struct modem_cmux_dlci *const dlcis[] = {data->dlci2, data->dlci1};
 
-	return 0;
-}
-
-static void modem_cellular_close_dlci2_event_handler(struct modem_cellular_data *data,
-						     enum modem_cellular_event evt)
-{
-	switch (evt)
-	{
-	case MODEM_CELLULAR_EVENT_DLCI2_CLOSED:
-		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_CLOSE_DLCI1);
-
-		break;
-
-	default:
-		break;
-	}
-}
-
-static int modem_cellular_on_close_dlci1_state_enter(struct modem_cellular_data *data)
-{
-	modem_pipe_close_async(data->dlci1_pipe);
+	modem_cmux_dlcis_close_async(data->cmux, dlcis, ARRAY_SIZE(dlcis));
 
 	return 0;
 }
 
-static void modem_cellular_close_dlci1_event_handler(struct modem_cellular_data *data,
+static void modem_cellular_close_dlcis_event_handler(struct modem_cellular_data *data,
 						     enum modem_cellular_event evt)
 {
 	switch (evt)
 	{
-	case MODEM_CELLULAR_EVENT_DLCI1_CLOSED:
+	case MODEM_CELLULAR_EVENT_DLCIS_CLOSED:
 		modem_cellular_enter_state(data, MODEM_CELLULAR_STATE_DISCONNECT_CMUX);
 
 		break;
@@ -675,7 +582,7 @@ static void modem_cellular_close_dlci1_event_handler(struct modem_cellular_data
 
 static int modem_cellular_on_disconnect_cmux_state_enter(struct modem_cellular_data *data)
 {
-	modem_cmux_disconnect_async(&data->cmux);
+	modem_cmux_disconnect_async(data->cmux);
 
 	return 0;
 }
@@ -711,13 +618,8 @@ static int modem_cellular_on_state_enter(struct modem_cellular_data *data)
 
 		break;
 
-	case MODEM_CELLULAR_STATE_OPEN_DLCI1:
-		ret = modem_cellular_on_open_dlci1_state_enter(data);
-
-		break;
-
-	case MODEM_CELLULAR_STATE_OPEN_DLCI2:
-		ret = modem_cellular_on_open_dlci2_state_enter(data);
+	case MODEM_CELLULAR_STATE_OPEN_DLCIS:
+		ret = modem_cellular_on_open_dlcis_state_enter(data);
 
 		break;
 
@@ -736,13 +638,8 @@ static int modem_cellular_on_state_enter(struct modem_cellular_data *data)
 
 		break;
 
-	case MODEM_CELLULAR_STATE_CLOSE_DLCI2:
-		ret = modem_cellular_on_close_dlci2_state_enter(data);
-
-		break;
-
-	case MODEM_CELLULAR_STATE_CLOSE_DLCI1:
-		ret = modem_cellular_on_close_dlci1_state_enter(data);
+	case MODEM_CELLULAR_STATE_CLOSE_DLCIS:
+		ret = modem_cellular_on_close_dlcis_state_enter(data);
 
 		break;
 
@@ -771,16 +668,6 @@ static int modem_cellular_on_state_leave(struct modem_cellular_data *data)
 
 		break;
 
-	case MODEM_CELLULAR_STATE_OPEN_DLCI1:
-		ret = modem_cellular_on_open_dlci1_state_leave(data);
-
-		break;
-
-	case MODEM_CELLULAR_STATE_OPEN_DLCI2:
-		ret = modem_cellular_on_open_dlci2_state_leave(data);
-
-		break;
-
 	case MODEM_CELLULAR_STATE_RUN_DIAL_SCRIPT:
 		ret = modem_cellular_on_run_dial_script_state_leave(data);
 
@@ -853,13 +740,8 @@ static void modem_cellular_event_handler(struct modem_cellular_data *data,
 
 		break;
 
-	case MODEM_CELLULAR_STATE_OPEN_DLCI1:
-		modem_cellular_open_dlci1_event_handler(data, evt);
-
-		break;
-
-	case MODEM_CELLULAR_STATE_OPEN_DLCI2:
-		modem_cellular_open_dlci2_event_handler(data, evt);
+	case MODEM_CELLULAR_STATE_OPEN_DLCIS:
+		modem_cellular_open_dlcis_event_handler(data, evt);
 
 		break;
 
@@ -878,13 +760,8 @@ static void modem_cellular_event_handler(struct modem_cellular_data *data,
 
 		break;
 
-	case MODEM_CELLULAR_STATE_CLOSE_DLCI2:
-		modem_cellular_close_dlci2_event_handler(data, evt);
-
-		break;
-
-	case MODEM_CELLULAR_STATE_CLOSE_DLCI1:
-		modem_cellular_close_dlci1_event_handler(data, evt);
+	case MODEM_CELLULAR_STATE_CLOSE_DLCIS:
+		modem_cellular_close_dlcis_event_handler(data, evt);
 
 		break;
 
@@ -916,6 +793,16 @@ static void modem_cellular_cmux_handler(struct modem_cmux *cmux, enum modem_cmux
 
 		break;
 
+	case MODEM_CMUX_EVENT_DLCIS_OPENED:
+		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCIS_OPENED);
+
+		break;
+
+	case MODEM_CMUX_EVENT_DLCIS_CLOSED:
+		modem_cellular_delegate_event(data, MODEM_CELLULAR_EVENT_DLCIS_CLOSED);
+
+		break;
+
 	default:
 		break;
 	}
@@ -946,41 +833,6 @@ static int modem_cellular_init(const struct device *dev)
 							  &uart_backend_config);
 	}
 
-	{
-		const struct modem_cmux_config cmux_config = {
-			.callback = modem_cellular_cmux_handler,
-			.user_data = data,
-			.receive_buf = data->cmux_receive_buf,
-			.receive_buf_size = ARRAY_SIZE(data->cmux_receive_buf),
-			.transmit_buf = data->cmux_transmit_buf,
-			.transmit_buf_size = ARRAY_SIZE(data->cmux_transmit_buf),
-		};
-
-		modem_cmux_init(&data->cmux, &cmux_config);
-	}
-
-	{
-		const struct modem_cmux_dlci_config dlci1_config = {
-			.dlci_address = 1,
-			.receive_buf = data->dlci1_receive_buf,
-			.receive_buf_size = ARRAY_SIZE(data->dlci1_receive_buf),
-		};
-
-		data->dlci1_pipe = modem_cmux_dlci_init(&data->cmux, &data->dlci1,
-							&dlci1_config);
-	}
-
-	{
-		const struct modem_cmux_dlci_config dlci2_config = {
-			.dlci_address = 2,
-			.receive_buf = data->dlci2_receive_buf,
-			.receive_buf_size = ARRAY_SIZE(data->dlci2_receive_buf),
-		};
-
-		data->dlci2_pipe = modem_cmux_dlci_init(&data->cmux, &data->dlci2,
-							&dlci2_config);
-	}
-
 	{
 		const struct modem_chat_config chat_config = {
 			.user_data = data,
@@ -1005,10 +857,53 @@ static int modem_cellular_init(const struct device *dev)
 	return 0;
 }
 
+/* Receive pool of PPP DLCI, one per instance as CMUX flow control assumes it is dedicated */
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+#define MODEM_CELLULAR_PPP_RECEIVE_POOL_DEFINE(inst)					\
+	NET_BUF_POOL_DEFINE(modem_cellular_ppp_receive_pool_##inst,			\
+			    CONFIG_MODEM_CELLULAR_CMUX_PPP_RECEIVE_BUFS,		\
+			    CONFIG_MODEM_CELLULAR_CMUX_RECEIVE_BUF_SIZE, 0, NULL);
+
+#define MODEM_CELLULAR_PPP_RECEIVE_POOL_GET(inst) (&modem_cellular_ppp_receive_pool_##inst)
+#else
+#define MODEM_CELLULAR_PPP_RECEIVE_POOL_DEFINE(inst)
+#define MODEM_CELLULAR_PPP_RECEIVE_POOL_GET(inst) NULL
+#endif
+
 #define MODEM_CELLULAR_DEVICE(node, inst)						\
 	MODEM_PPP_DEFINE(ppp, NULL, 98, 1500, 64, 8);					\
 											\
+	static struct modem_cellular_data modem_cellular_data_##inst;			\
+											\
+	MODEM_CELLULAR_PPP_RECEIVE_POOL_DEFINE(inst)					\
+											\
+	/* DLCI1 carries AT commands, served ahead of PPP data on DLCI2 */		\
+	static const struct modem_cmux_dlci_config					\
+		modem_cellular_dlci_configs_##inst[] = {				\
+		{									\
+			.dlci_address = 1,						\
+			.priority = 0,							\
+		},									\
+		{									\
+			.dlci_address = 2,						\
+			.priority = 1,							\
+			.receive_buf_pool = MODEM_CELLULAR_PPP_RECEIVE_POOL_GET(inst),	\
+		},									\
+	};										\
+											\
+	MODEM_CMUX_DEFINE(modem_cellular_cmux_##inst, modem_cellular_cmux_handler,	\
+			  &modem_cellular_data_##inst,					\
+			  modem_cellular_dlci_configs_##inst,				\
+			  CONFIG_MODEM_CELLULAR_CMUX_RECEIVE_BUF_SIZE,			\
+			  CONFIG_MODEM_CELLULAR_CMUX_TRANSMIT_BUF_SIZE,			\
+			  CONFIG_MODEM_CELLULAR_CMUX_DLCI_BUF_SIZE);			\
+											\
 	static struct modem_cellular_data modem_cellular_data_##inst = {		\
+		.cmux = MODEM_CMUX_GET(modem_cellular_cmux_##inst),			\
+		.dlci1 = MODEM_CMUX_DLCI_GET(modem_cellular_cmux_##inst, 1),		\
+		.dlci2 = MODEM_CMUX_DLCI_GET(modem_cellular_cmux_##inst, 2),		\
+		.dlci1_pipe = MODEM_CMUX_DLCI_PIPE_GET(modem_cellular_cmux_##inst, 1),	\
+		.dlci2_pipe = MODEM_CMUX_DLCI_PIPE_GET(modem_cellular_cmux_##inst, 2),	\
 		.chat_delimiter = {'\r'},						\
 		.chat_filter = {'\n'},							\
 		.ppp = &ppp,								\
@@ -20,12 +20,17 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <zephyr/types.h>
 #include <zephyr/sys/ring_buffer.h>
 #include <zephyr/sys/atomic.h>
 
 #include <zephyr/modem/pipe.h>
 
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+#include <zephyr/net/buf.h>
+#endif
+
 #ifndef ZEPHYR_MODEM_CMUX_
 #define ZEPHYR_MODEM_CMUX_
 
@@ -45,6 +50,38 @@ enum modem_cmux_state {
 enum modem_cmux_event {
 	MODEM_CMUX_EVENT_CONNECTED = 0,
 	MODEM_CMUX_EVENT_DISCONNECTED,
+	MODEM_CMUX_EVENT_POWER_SAVE_ENTERED,
+	MODEM_CMUX_EVENT_POWER_SAVE_EXITED,
+	MODEM_CMUX_EVENT_UNRESPONSIVE,
+	MODEM_CMUX_EVENT_CONNECT_FAILED,
+	MODEM_CMUX_EVENT_DLCIS_OPENED,
+	MODEM_CMUX_EVENT_DLCIS_CLOSED,
+};
+
+/**
+ * @brief CMUX framing option
+ * @details Must match the option selected on the remote, typically with the first
+ * parameter of the AT+CMUX command.
+ */
+enum modem_cmux_option {
+	/* Frames delimited by 0xF9 flags with length field */
+	MODEM_CMUX_OPTION_BASIC = 0,
+	/* Frames delimited by 0x7E flags with control octet transparency */
+	MODEM_CMUX_OPTION_ADVANCED,
+};
+
+/**
+ * @brief CMUX station role
+ * @details The initiator establishes the multiplexer and opens DLCIs, while the
+ * responder answers, as done by a modem. DLCI pipes of the responder are opened once
+ * the initiator opens the DLCI. The C/R bit of all frames transmitted by the responder
+ * is inverted.
+ */
+enum modem_cmux_role {
+	/* Transmit SABM to connect and to open DLCIs */
+	MODEM_CMUX_ROLE_INITIATOR = 0,
+	/* Answer SABM and DISC received from initiator */
+	MODEM_CMUX_ROLE_RESPONDER,
 };
 
 typedef void (*modem_cmux_callback)(struct modem_cmux *cmux, enum modem_cmux_event event,
@@ -69,6 +106,7 @@ enum modem_cmux_receive_state {
 
 enum modem_cmux_dlci_state {
 	MODEM_CMUX_DLCI_STATE_CLOSED,
+	MODEM_CMUX_DLCI_STATE_NEGOTIATING,
 	MODEM_CMUX_DLCI_STATE_OPENING,
 	MODEM_CMUX_DLCI_STATE_OPEN,
 	MODEM_CMUX_DLCI_STATE_CLOSING,
@@ -79,6 +117,83 @@ enum modem_cmux_dlci_event {
 	MODEM_CMUX_DLCI_EVENT_CLOSED,
 };
 
+/**
+ * @brief V.24 signals carried by the MSC command
+ * @details Bit positions match the control signal octet defined by 3GPP TS 27.010
+ */
+enum modem_cmux_signal {
+	/* Flow control, set when DLCI is unable to accept frames */
+	MODEM_CMUX_SIGNAL_FC = BIT(1),
+	/* Ready to communicate (DTR/DSR) */
+	MODEM_CMUX_SIGNAL_RTC = BIT(2),
+	/* Ready to receive (RTS/CTS) */
+	MODEM_CMUX_SIGNAL_RTR = BIT(3),
+	/* Incoming call indicator (RI) */
+	MODEM_CMUX_SIGNAL_IC = BIT(6),
+	/* Data valid (DCD) */
+	MODEM_CMUX_SIGNAL_DV = BIT(7),
+};
+
+/**
+ * @brief Line errors carried by the RLS command
+ * @details Bit positions match the line status octet defined by 3GPP TS 27.010
+ */
+enum modem_cmux_line_status {
+	/* Received data was lost as receive buffer was full */
+	MODEM_CMUX_LINE_STATUS_OVERRUN = BIT(1),
+	/* Received data had parity error */
+	MODEM_CMUX_LINE_STATUS_PARITY = BIT(2),
+	/* Received data had framing error */
+	MODEM_CMUX_LINE_STATUS_FRAMING = BIT(3),
+};
+
+/**
+ * @brief DLCI channel statistics
+ * @param rx_frames Number of data frames received
+ * @param rx_bytes Number of data bytes received
+ * @param rx_dropped Number of received data bytes dropped due to receive buffer overrun
+ * @param tx_frames Number of data frames transmitted, including retransmissions
+ * @param tx_bytes Number of data bytes transmitted, including retransmissions
+ * @param tx_rejected Number of bytes not queued by pipe transmit due to transmit buffer full
+ * @param receive_buf_max High-water mark of receive buffer in bytes
+ * @param transmit_buf_max High-water mark of transmit buffer in bytes
+ */
+struct modem_cmux_dlci_stats {
+	uint32_t rx_frames;
+	uint32_t rx_bytes;
+	uint32_t rx_dropped;
+	uint32_t tx_frames;
+	uint32_t tx_bytes;
+	uint32_t tx_rejected;
+	uint32_t receive_buf_max;
+	uint32_t transmit_buf_max;
+};
+
+/**
+ * @brief CMUX statistics
+ * @param rx_frames Number of valid frames received
+ * @param tx_frames Number of frames transmitted
+ * @param fcs_errors Number of received frames dropped due to invalid FCS
+ * @param resyncs Number of times synchronization to received frames was lost
+ * @param dropped_frames Number of received frames dropped due to receive buffer overrun
+ * or malformed frame
+ * @param unknown_dlci_frames Number of received frames addressed to unknown DLCI
+ * @param tx_rejected Number of command frames not transmitted due to transmit buffer full
+ * @param receive_buf_max Largest frame received in bytes, high-water mark of receive buffer
+ * @param transmit_buf_max High-water mark of transmit buffer in bytes
+ */
+struct modem_cmux_stats {
+	uint32_t rx_frames;
+	uint32_t tx_frames;
+	uint32_t fcs_errors;
+	uint32_t resyncs;
+	uint32_t dropped_frames;
+	uint32_t unknown_dlci_frames;
+	uint32_t tx_rejected;
+	uint32_t receive_buf_max;
+	uint32_t transmit_buf_max;
+};
+
 struct modem_cmux_dlci;
 
 struct modem_cmux_dlci_work {
@@ -100,9 +215,94 @@ struct modem_cmux_dlci {
 	struct ring_buf receive_rb;
 	struct k_mutex receive_rb_lock;
 
+	/* Receive buffer flow control */
+	uint16_t receive_rb_high_watermark;
+	uint16_t receive_rb_low_watermark;
+	bool receive_rb_stopped;
+	uint32_t receive_rb_dropped;
+
+	/* Overrun reported to remote with RLS command until receive buffer is drained */
+	bool receive_rb_overrun;
+
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	/* Received data queued in network buffers rather than receive buffer */
+	struct net_buf_pool *receive_buf_pool;
+	sys_slist_t receive_bufs;
+	uint32_t receive_bufs_len;
+	uint16_t receive_bufs_count;
+#endif
+
+	/* Transmit queue */
+	struct ring_buf transmit_rb;
+	struct k_mutex transmit_rb_lock;
+
+	/* Buffers allocated from slab while DLCI is open */
+	struct k_mem_slab *buf_slab;
+	uint8_t *receive_block;
+	uint8_t *transmit_block;
+	uint16_t receive_buf_size;
+	uint16_t transmit_buf_size;
+
+	/* Parameters, negotiated with PN command if enabled */
+	bool negotiate;
+	uint16_t data_size_max;
+
+	/* Transmit scheduling */
+	uint8_t priority;
+	uint8_t weight;
+	uint8_t transmit_credit;
+
+	/* Transmit coalescing */
+	uint16_t coalesce_size;
+	uint32_t coalesce_timeout_ticks;
+	int64_t coalesce_start_ticks;
+	bool coalesce_flush;
+
+#if defined(CONFIG_MODEM_CMUX_STATISTICS)
+	/* Statistics */
+	struct modem_cmux_dlci_stats stats;
+#endif
+
+	/* V.24 signals received from remote with MSC command */
+	uint8_t remote_signals;
+
+	/* V.24 signals transmitted to remote with MSC command */
+	uint8_t local_signals;
+
+	/* Line errors received from remote with RLS command, cleared when read */
+	uint8_t remote_line_status;
+
+	/* Data transmitted in UI frames rather than UIH frames */
+	bool ui_frames;
+
+	/* Data written to pipe is queued entirely or not at all */
+	bool atomic_transmit;
+
+	/* Error recovery mode, sequence numbers are modulo 8 */
+	bool error_recovery;
+	uint8_t window_size;
+	uint8_t send_seq;
+	uint8_t send_seq_end;
+	uint8_t ack_seq;
+	uint8_t receive_seq;
+	uint16_t unacked_len[8];
+	uint16_t unacked_size;
+	bool remote_busy;
+	bool local_busy;
+	bool reject_sent;
+	bool reject_pending;
+	bool ack_pending;
+	bool final_pending;
+	uint8_t retransmit_count;
+
+	/* SABM or DISC frame awaiting UA frame */
+	int64_t command_sent_ticks;
+	uint8_t command_attempts;
+
 	/* Work */
 	struct modem_cmux_dlci_work open_work;
 	struct modem_cmux_dlci_work close_work;
+	struct modem_cmux_dlci_work retransmit_work;
 
 	/* State */
 	enum modem_cmux_dlci_state state;
@@ -122,6 +322,24 @@ struct modem_cmux_work {
 	struct modem_cmux *cmux;
 };
 
+/**
+ * @brief Keepalive statistics
+ * @param rtt_min_us Shortest round trip time of TEST command
+ * @param rtt_avg_us Average round trip time of TEST command
+ * @param rtt_max_us Longest round trip time of TEST command
+ * @param sent Number of TEST commands transmitted
+ * @param received Number of valid TEST responses received
+ * @param missed Number of TEST commands not answered in time
+ */
+struct modem_cmux_keepalive_stats {
+	uint32_t rtt_min_us;
+	uint32_t rtt_avg_us;
+	uint32_t rtt_max_us;
+	uint32_t sent;
+	uint32_t received;
+	uint32_t missed;
+};
+
 struct modem_cmux {
 	/* Bus pipe */
 	struct modem_pipe *pipe;
@@ -133,12 +351,24 @@ struct modem_cmux {
 	/* DLCI channel contexts */
 	sys_slist_t dlcis;
 
+	/* Optional DLCI channel contexts indexed by DLCI address */
+	struct modem_cmux_dlci **dlci_table;
+	uint8_t dlci_table_size;
+
 	/* State */
 	enum modem_cmux_state state;
 	bool flow_control_on;
 
+	/* Framing option */
+	enum modem_cmux_option option;
+
+	/* Station role */
+	enum modem_cmux_role role;
+
 	/* Receive state*/
 	enum modem_cmux_receive_state receive_state;
+	bool receive_escape;
+	int64_t resync_allowed_ticks;
 
 	/* Receive buffer */
 	uint8_t *receive_buf;
@@ -149,6 +379,61 @@ struct modem_cmux {
 	struct ring_buf transmit_rb;
 	struct k_mutex transmit_rb_lock;
 
+	/* Transmit stage buffer */
+	uint8_t *transmit_stage_buf;
+	uint16_t transmit_stage_buf_size;
+	uint16_t transmit_stage_len;
+	uint16_t transmit_stage_split;
+
+	/* Bitmasks of DLCI addresses opened or closed together */
+	uint64_t dlcis_opening;
+	uint64_t dlcis_closing;
+
+	/* DLCI currently served by transmit scheduler */
+	struct modem_cmux_dlci *transmit_dlci;
+
+	/* Transmit from writer's context while transmit work is idle */
+	bool direct_transmit;
+
+	/* Power saving */
+	uint32_t power_save_timeout_ms;
+	bool power_save_requested;
+	bool power_saving;
+	bool power_save_entered;
+	bool waking;
+	uint16_t wake_up_attempts;
+	bool receive_skip_flags;
+
+	/* Timers and retransmissions */
+	uint32_t t1_timeout_ms;
+	uint32_t t2_timeout_ms;
+	uint8_t n2;
+	bool adaptive_timeouts;
+	uint32_t adaptive_t1_timeout_ms;
+	uint32_t rtt_smoothed_us;
+	uint32_t rtt_variation_us;
+	int64_t command_sent_ticks;
+	uint8_t command_attempts;
+
+	/* Keepalive */
+	uint32_t keepalive_interval_ms;
+	uint32_t keepalive_seq;
+	int64_t keepalive_sent_ticks;
+	bool keepalive_pending;
+	uint8_t keepalive_missed;
+	uint64_t keepalive_rtt_sum_us;
+	struct modem_cmux_keepalive_stats keepalive_stats;
+
+#if defined(CONFIG_MODEM_CMUX_STATISTICS)
+	/* Statistics */
+	struct modem_cmux_stats stats;
+#endif
+
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+	/* Instances listed by shell */
+	sys_snode_t node;
+#endif
+
 	/* Received frame */
 	struct modem_cmux_frame frame;
 	uint8_t frame_header[5];
@@ -159,28 +444,94 @@ struct modem_cmux {
 	struct modem_cmux_work transmit_work;
 	struct modem_cmux_work connect_work;
 	struct modem_cmux_work disconnect_work;
+	struct modem_cmux_work power_save_work;
+	struct modem_cmux_work wake_up_work;
+	struct modem_cmux_work keepalive_work;
+	struct modem_cmux_work coalesce_work;
+	struct k_work_q *work_q;
+	uint16_t receive_budget;
 
 	/* Synchronize actions */
 	struct k_event event;
 };
 
+/**
+ * @brief Executor shared by CMUX instances
+ * @details Runs the work of all CMUX instances using it on a single work queue thread, so
+ * adding CMUX instances does not add threads or context switches. Instances take turns in
+ * the order their work becomes ready. Each turn receives at most the receive budget of the
+ * instance and transmits at most a single burst to its bus pipe, so a busy instance cannot
+ * starve the others.
+ */
+struct modem_cmux_executor {
+	struct k_work_q work_q;
+};
+
 /**
  * @brief Contains CMUX instance confuguration data
  * @param callback Invoked when event occurs
  * @param user_data Free to use pointer passed to event handler when invoked
+ * @param option Framing option, basic unless set
  * @param receive_buf Receive buffer
  * @param receive_buf_size Size of receive buffer in bytes [127, ...]
  * @param transmit_buf Transmit buffer
  * @param transmit_buf_size Size of transmit buffer in bytes [149, ...]
  * @param receive_timeout Timeout from data is received until data is read
+ * @param power_save_timeout_ms Time without data on any DLCI after which power saving is
+ * requested with the PSC command. 0 disables power saving
+ * @param keepalive_interval_ms Interval between TEST commands transmitted to check that
+ * remote is responsive. MODEM_CMUX_EVENT_UNRESPONSIVE is raised if
+ * CONFIG_MODEM_CMUX_KEEPALIVE_MISSED_MAX consecutive TEST commands are not answered.
+ * 0 disables keepalive
+ * @param transmit_stage_buf Optional linear buffer into which frames are copied from the
+ * transmit buffer, which may wrap, so the bus pipe is given full bursts of frames
+ * rather than the contiguous part of the transmit buffer. Should match the transmit
+ * buffer size of the bus backend
+ * @param transmit_stage_buf_size Size of transmit stage buffer in bytes
+ * @param role Station role, initiator unless set
+ * @param t1_timeout_ms Time to wait for UA frame or command response before retransmitting,
+ * 330 ms unless set
+ * @param t2_timeout_ms Time to wait for response to control channel command, 660 ms unless
+ * set. Never shorter than twice T1
+ * @param n2 Maximum number of retransmissions of SABM and DISC frames and CLD and PN
+ * commands. MODEM_CMUX_EVENT_CONNECT_FAILED is raised if connecting fails, the DLCI pipe
+ * is closed if opening the DLCI fails, and the DLCI is opened with default parameters if
+ * PN is not answered. 0 retransmits indefinitely
+ * @param adaptive_timeouts Derive T1 from round trip times measured for SABM, DISC and
+ * TEST frames, between 10 ms and 2550 ms, rather than using t1_timeout_ms once measured
+ * @param dlci_table Optional table in which DLCIs are looked up by address rather than
+ * searched for among all DLCIs. DLCIs with addresses beyond the table are still searched for
+ * @param dlci_table_size Number of entries in DLCI table
+ * @param direct_transmit Transmit data written to DLCIs from the writer's context while the
+ * transmit work is idle, saving a work queue hop. The transmit work is used if busy, and
+ * transmits what the bus pipe does not accept
+ * @param executor Executor shared with other CMUX instances, which runs the work of the
+ * instance. The system work queue is used if NULL
+ * @param receive_budget Max number of bytes received from bus pipe in one turn, before
+ * yielding to other work. 0 selects 16
  */
 struct modem_cmux_config {
 	modem_cmux_callback callback;
 	void *user_data;
+	enum modem_cmux_option option;
 	uint8_t *receive_buf;
 	uint16_t receive_buf_size;
 	uint8_t *transmit_buf;
 	uint16_t transmit_buf_size;
+	uint32_t power_save_timeout_ms;
+	uint32_t keepalive_interval_ms;
+	uint8_t *transmit_stage_buf;
+	uint16_t transmit_stage_buf_size;
+	enum modem_cmux_role role;
+	uint32_t t1_timeout_ms;
+	uint32_t t2_timeout_ms;
+	uint8_t n2;
+	bool adaptive_timeouts;
+	struct modem_cmux_dlci **dlci_table;
+	uint8_t dlci_table_size;
+	bool direct_transmit;
+	struct modem_cmux_executor *executor;
+	uint16_t receive_budget;
 };
 
 /**
@@ -188,16 +539,103 @@ struct modem_cmux_config {
  */
 void modem_cmux_init(struct modem_cmux *cmux, const struct modem_cmux_config *config);
 
+/**
+ * @brief Start CMUX executor
+ * @param executor Executor instance
+ * @param stack Stack of executor thread
+ * @param stack_size Size of stack of executor thread
+ * @param priority Priority of executor thread
+ */
+void modem_cmux_executor_start(struct modem_cmux_executor *executor, k_thread_stack_t *stack,
+			       size_t stack_size, int priority);
+
+/**
+ * @brief Define a CMUX executor, started at boot with priority CONFIG_MODEM_CMUX_INIT_PRIORITY
+ * @param _name Name of executor
+ * @param _stack_size Size of stack of executor thread
+ * @param _priority Priority of executor thread
+ */
+#define MODEM_CMUX_EXECUTOR_DEFINE(_name, _stack_size, _priority)                                  \
+	static K_THREAD_STACK_DEFINE(_name##_stack, _stack_size);                                  \
+	static struct modem_cmux_executor _name;                                                   \
+                                                                                                   \
+	static int _name##_start(void)                                                             \
+	{                                                                                          \
+		modem_cmux_executor_start(&_name, _name##_stack,                                   \
+					  K_THREAD_STACK_SIZEOF(_name##_stack), _priority);        \
+		return 0;                                                                          \
+	}                                                                                          \
+                                                                                                   \
+	SYS_INIT(_name##_start, POST_KERNEL, CONFIG_MODEM_CMUX_INIT_PRIORITY)
+
 /**
  * @brief CMUX DLCI configuration
  * @param dlci_address DLCI channel address
  * @param receive_buf Receive buffer used by pipe
  * @param receive_buf_size Size of receive buffer used by pipe [127, ...]
+ * @param transmit_buf Transmit queue used by pipe. Data written to the pipe is queued here
+ * until the CMUX transmit scheduler frames it. Shall not be NULL unless buf_slab is set;
+ * DLCIs no longer write directly into the CMUX transmit buffer, so a configuration without
+ * a transmit queue can not transmit
+ * @param transmit_buf_size Size of transmit queue used by pipe [8, ...]
+ * @param priority Transmit priority, 0 is highest. DLCIs with pending data and a higher
+ * priority are always served first
+ * @param weight Number of consecutive frames transmitted from DLCI before yielding to the
+ * next DLCI with the same priority. 0 is treated as 1
+ * @param receive_buf_high_watermark Number of bytes in receive buffer at which remote is
+ * asked to stop transmitting on DLCI. 0 selects 3/4 of receive_buf_size
+ * @param receive_buf_low_watermark Number of bytes in receive buffer at which remote is
+ * allowed to resume transmitting on DLCI. 0 selects 1/4 of receive_buf_size
+ * @param negotiate Negotiate parameters with remote using PN command before opening DLCI
+ * @param data_size_max Max data size of frames (N1), limited by the CMUX receive buffer
+ * size, less one byte if the advanced option is used. Proposed to remote if negotiate is
+ * set. 0 selects 127
+ * @param error_recovery Transmit data in I frames which are acknowledged by remote and
+ * retransmitted if lost, see 3GPP TS 27.010 error recovery mode. Should be used with the
+ * advanced option. Proposed to remote if negotiate is set
+ * @param window_size Max number of unacknowledged I frames (k) [1, 7]. 0 selects 2
+ * @param coalesce_timeout_us Time data written to an idle DLCI is held back, so following
+ * writes are transmitted in the same frame. 0 disables coalescing
+ * @param coalesce_size Number of queued bytes which ends coalescing early. 0 selects
+ * data_size_max
+ * @param buf_slab Memory slab from which receive and transmit buffers are allocated when
+ * the DLCI is opened, and to which they are freed when it is closed. receive_buf and
+ * transmit_buf shall be NULL, receive_buf_size and transmit_buf_size shall not exceed the
+ * block size of the slab. Static buffers are used if NULL
+ * @param ui_frames Transmit data in UI frames, with FCS computed over data, rather than in
+ * UIH frames. Proposed to remote if negotiate is set. UI frames are always received
+ * @param atomic_transmit Queue data written to pipe entirely or not at all, rather than as
+ * much of it as fits in the transmit queue. Writes larger than transmit_buf_size fail with
+ * -EMSGSIZE
+ * @param receive_buf_pool Pool of network buffers into which the data of received UIH and
+ * UI frames is packed, filling the tailroom of the last queued buffer before allocating
+ * another. The buffers are taken by the pipe user with modem_pipe_receive_buf(), saving
+ * copying data through the receive buffer, and can still be read with modem_pipe_receive().
+ * Watermarks apply to the data queued in buffers, and the remote is also asked to stop
+ * transmitting when at most one buffer of the pool is left. The pool shall be dedicated to
+ * the DLCI. Data not fitting in the pool is dropped. Requires CONFIG_MODEM_CMUX_NET_BUF, and
+ * shall not be used with error_recovery. The receive buffer is used if NULL
  */
 struct modem_cmux_dlci_config {
 	uint8_t dlci_address;
 	uint8_t *receive_buf;
 	uint16_t receive_buf_size;
+	uint16_t receive_buf_high_watermark;
+	uint16_t receive_buf_low_watermark;
+	uint8_t *transmit_buf;
+	uint16_t transmit_buf_size;
+	uint8_t priority;
+	uint8_t weight;
+	bool negotiate;
+	uint16_t data_size_max;
+	bool error_recovery;
+	uint8_t window_size;
+	uint32_t coalesce_timeout_us;
+	uint16_t coalesce_size;
+	struct k_mem_slab *buf_slab;
+	bool ui_frames;
+	bool atomic_transmit;
+	struct net_buf_pool *receive_buf_pool;
 };
 
 /**
@@ -209,6 +647,91 @@ struct modem_cmux_dlci_config {
 struct modem_pipe *modem_cmux_dlci_init(struct modem_cmux *cmux, struct modem_cmux_dlci *dlci,
 					const struct modem_cmux_dlci_config *config);
 
+/**
+ * @brief Unregister closed DLCI instance from CMUX instance
+ * @details Allows DLCI instances to be created and removed at runtime. The DLCI pipe
+ * shall be closed, and shall not be used after this call.
+ * @param dlci DLCI instance
+ * @returns 0 if successful
+ * @returns -EBUSY if DLCI is not closed
+ */
+int modem_cmux_dlci_deinit(struct modem_cmux_dlci *dlci);
+
+/**
+ * @brief Transmit data queued on DLCI without waiting for coalescing to end
+ * @details Hint for latency sensitive writers, which shall be called after the last write
+ * of a message. Has no effect if coalescing is disabled.
+ * @param dlci DLCI instance
+ */
+void modem_cmux_dlci_flush(struct modem_cmux_dlci *dlci);
+
+/**
+ * @brief Get V.24 signals most recently received from remote for DLCI
+ * @details The DLCI pipe raises MODEM_PIPE_EVENT_SIGNALS_CHANGED when any signal
+ * except MODEM_CMUX_SIGNAL_FC changes.
+ * @param dlci DLCI instance
+ * @returns Bitmask of enum modem_cmux_signal
+ */
+uint8_t modem_cmux_dlci_get_remote_signals(struct modem_cmux_dlci *dlci);
+
+/**
+ * @brief Get and clear line errors reported by remote for DLCI
+ * @details The DLCI pipe raises MODEM_PIPE_EVENT_LINE_ERROR when the remote reports a line
+ * error with the RLS command. Errors accumulate until read. The DLCI reports
+ * MODEM_CMUX_LINE_STATUS_OVERRUN to the remote when its receive buffer overruns.
+ * @param dlci DLCI instance
+ * @returns Bitmask of enum modem_cmux_line_status
+ */
+uint8_t modem_cmux_dlci_get_remote_line_status(struct modem_cmux_dlci *dlci);
+
+/**
+ * @brief Set V.24 signals transmitted to remote for DLCI
+ * @details Signals are transmitted with the MSC command if the DLCI is open, and are
+ * included in MSC commands later transmitted by the DLCI. MODEM_CMUX_SIGNAL_FC is
+ * managed by the DLCI and ignored.
+ * @param dlci DLCI instance
+ * @param signals Bitmask of enum modem_cmux_signal
+ * @returns 0 if successful
+ * @returns -ENOMEM if command could not be queued for transmission
+ */
+int modem_cmux_dlci_set_signals(struct modem_cmux_dlci *dlci, uint8_t signals);
+
+/**
+ * @brief Set aggregate flow control of remote
+ * @details Transmits the FCON or FCOFF command, allowing or stopping the remote from
+ * transmitting data on all DLCIs.
+ * @param cmux CMUX instance
+ * @param on True to transmit FCON, false to transmit FCOFF
+ * @returns 0 if successful
+ * @returns -EPERM if not connected
+ * @returns -ENOMEM if command could not be queued for transmission
+ */
+int modem_cmux_set_flow_control(struct modem_cmux *cmux, bool on);
+
+/**
+ * @brief Get keepalive statistics
+ * @param cmux CMUX instance
+ * @param stats Destination for statistics
+ */
+void modem_cmux_get_keepalive_stats(struct modem_cmux *cmux,
+				    struct modem_cmux_keepalive_stats *stats);
+
+#if defined(CONFIG_MODEM_CMUX_STATISTICS) || defined(__DOXYGEN__)
+/**
+ * @brief Get CMUX statistics
+ * @param cmux CMUX instance
+ * @param stats Destination for statistics
+ */
+void modem_cmux_get_stats(struct modem_cmux *cmux, struct modem_cmux_stats *stats);
+
+/**
+ * @brief Get DLCI channel statistics
+ * @param dlci DLCI instance
+ * @param stats Destination for statistics
+ */
+void modem_cmux_dlci_get_stats(struct modem_cmux_dlci *dlci, struct modem_cmux_dlci_stats *stats);
+#endif
+
 /**
  * @brief Initialize CMUX instance
  */
@@ -217,7 +740,8 @@ int modem_cmux_attach(struct modem_cmux *cmux, struct modem_pipe *pipe);
 /**
  * @brief Connect CMUX instance
  * @details This will send a CMUX connect request to target on the serial bus. If successful,
- * DLCI channels can be now be opened using modem_pipe_open()
+ * DLCI channels can be now be opened using modem_pipe_open(). If the responder role is
+ * used, this waits for the connect request from the initiator instead.
  * @param cmux CMUX instance
  * @param pipe pipe used to transmit data to and from bus
  * @note When connected, the bus pipe must not be used directly
@@ -227,7 +751,8 @@ int modem_cmux_connect(struct modem_cmux *cmux);
 /**
  * @brief Connect CMUX instance asynchronously
  * @details This will send a CMUX connect request to target on the serial bus. If successful,
- * DLCI channels can be now be opened using modem_pipe_open().
+ * DLCI channels can be now be opened using modem_pipe_open(). If the responder role is
+ * used, this starts listening for the connect request from the initiator instead.
  * @param cmux CMUX instance
  * @param pipe pipe used to transmit data to and from bus
  * @note When connected, the bus pipe must not be used directly
@@ -248,8 +773,148 @@ int modem_cmux_disconnect(struct modem_cmux *cmux);
  */
 int modem_cmux_disconnect_async(struct modem_cmux *cmux);
 
+/**
+ * @brief Open DLCIs concurrently
+ * @details The SABM frames of all DLCIs are transmitted at once, and the UA frame of each
+ * DLCI is awaited independently, rather than opening DLCIs one round trip at a time. The
+ * DLCI pipes are notified as each DLCI is opened, and MODEM_CMUX_EVENT_DLCIS_OPENED is
+ * raised once every DLCI is open or failed to open. DLCIs already open are skipped.
+ * @param cmux CMUX instance
+ * @param dlcis DLCI instances of CMUX instance
+ * @param dlcis_size Number of DLCI instances
+ * @returns 0 if successful
+ * @returns -EBUSY if DLCIs are already being opened
+ * @returns -ENOMEM if buffers could not be allocated for a DLCI
+ */
+int modem_cmux_dlcis_open_async(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+				uint8_t dlcis_size);
+
+/**
+ * @brief Open DLCIs concurrently and wait for all to be opened
+ * @note Waits up to T1 times N2 + 1 for each of the PN and SABM exchanges
+ * @returns 0 if all DLCIs are open
+ * @returns -EAGAIN if DLCIs were not opened in time
+ * @returns -EIO if a DLCI failed to open
+ * @see modem_cmux_dlcis_open_async()
+ */
+int modem_cmux_dlcis_open(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+			  uint8_t dlcis_size);
+
+/**
+ * @brief Close DLCIs concurrently
+ * @details The DISC frames of all DLCIs are transmitted at once. The DLCI pipes are
+ * notified as each DLCI is closed, and MODEM_CMUX_EVENT_DLCIS_CLOSED is raised once every
+ * DLCI is closed. DLCIs already closed are skipped.
+ * @param cmux CMUX instance
+ * @param dlcis DLCI instances of CMUX instance
+ * @param dlcis_size Number of DLCI instances
+ * @returns 0 if successful
+ * @returns -EBUSY if DLCIs are already being closed
+ */
+int modem_cmux_dlcis_close_async(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+				 uint8_t dlcis_size);
+
+/**
+ * @brief Close DLCIs concurrently and wait for all to be closed
+ * @note Waits up to T1 times N2 + 1 for the DISC exchange
+ * @returns 0 if all DLCIs are closed
+ * @returns -EAGAIN if DLCIs were not closed in time
+ * @see modem_cmux_dlcis_close_async()
+ */
+int modem_cmux_dlcis_close(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+			   uint8_t dlcis_size);
+
 void modem_cmux_release(struct modem_cmux *cmux);
 
+/**
+ * @brief Initialize CMUX instance defined with MODEM_CMUX_DEFINE() and its DLCIs
+ *
+ * @warning Should not be used directly
+ * @returns 0 if successful
+ * @returns -EINVAL if DLCI addresses are not contiguous from 1 in order of configuration
+ */
+int modem_cmux_init_internal(struct modem_cmux *cmux, const struct modem_cmux_config *config,
+			     struct modem_cmux_dlci *dlcis,
+			     const struct modem_cmux_dlci_config *dlci_configs, uint8_t dlcis_size,
+			     uint8_t *dlci_bufs, uint16_t dlci_buf_size);
+
+/**
+ * @brief Define a CMUX instance with its DLCIs
+ * @details The CMUX instance, a table of its DLCIs indexed by DLCI address, and all CMUX and
+ * DLCI buffers are laid out in a single statically allocated block, which is initialized
+ * at boot with priority CONFIG_MODEM_CMUX_INIT_PRIORITY.
+ *
+ * The DLCIs are configured by an array of DLCI configurations, ordered by DLCI address from
+ * 1 and up. The DLCI addresses shall be contiguous, as the DLCI of an address is found at
+ * index address - 1 of the array. Initialization fails with -EINVAL otherwise. The buffers of
+ * the DLCI configurations are ignored, each DLCI is given a receive and transmit buffer of
+ * @p _dlci_buf_size bytes from the block.
+ *
+ * @param _name Name of CMUX instance
+ * @param _callback Callback for CMUX events, may be NULL
+ * @param _user_data User data passed to callback
+ * @param _dlci_configs Array of DLCI configurations
+ * @param _receive_buf_size Size of CMUX receive buffer
+ * @param _transmit_buf_size Size of CMUX transmit buffer and transmit stage buffer
+ * @param _dlci_buf_size Size of receive and transmit buffer of each DLCI
+ */
+#define MODEM_CMUX_DEFINE(_name, _callback, _user_data, _dlci_configs, _receive_buf_size,         \
+			  _transmit_buf_size, _dlci_buf_size)                                      \
+	static struct {                                                                            \
+		struct modem_cmux cmux;                                                            \
+		struct modem_cmux_dlci *dlci_table[ARRAY_SIZE(_dlci_configs) + 1];                 \
+		struct modem_cmux_dlci dlcis[ARRAY_SIZE(_dlci_configs)];                           \
+		uint8_t receive_buf[_receive_buf_size];                                            \
+		uint8_t transmit_buf[_transmit_buf_size];                                          \
+		uint8_t transmit_stage_buf[_transmit_buf_size];                                    \
+		uint8_t dlci_bufs[ARRAY_SIZE(_dlci_configs)][2][_dlci_buf_size];                   \
+	} _name##_block;                                                                           \
+                                                                                                   \
+	static const struct modem_cmux_config _name##_config = {                                   \
+		.callback = _callback,                                                             \
+		.user_data = _user_data,                                                           \
+		.receive_buf = _name##_block.receive_buf,                                          \
+		.receive_buf_size = _receive_buf_size,                                             \
+		.transmit_buf = _name##_block.transmit_buf,                                        \
+		.transmit_buf_size = _transmit_buf_size,                                           \
+		.transmit_stage_buf = _name##_block.transmit_stage_buf,                            \
+		.transmit_stage_buf_size = _transmit_buf_size,                                     \
+		.dlci_table = _name##_block.dlci_table,                                            \
+		.dlci_table_size = ARRAY_SIZE(_dlci_configs) + 1,                                  \
+	};                                                                                         \
+                                                                                                   \
+	static int _name##_init(void)                                                              \
+	{                                                                                          \
+		return modem_cmux_init_internal(&_name##_block.cmux, &_name##_config,              \
+						_name##_block.dlcis, _dlci_configs,                \
+						ARRAY_SIZE(_dlci_configs),                         \
+						&_name##_block.dlci_bufs[0][0][0],                 \
+						_dlci_buf_size);                                   \
+	}                                                                                          \
+                                                                                                   \
+	SYS_INIT(_name##_init, POST_KERNEL, CONFIG_MODEM_CMUX_INIT_PRIORITY)
+
+/**
+ * @brief Get CMUX instance defined with MODEM_CMUX_DEFINE()
+ * @param _name Name of CMUX instance
+ */
+#define MODEM_CMUX_GET(_name) (&_name##_block.cmux)
+
+/**
+ * @brief Get DLCI instance of CMUX instance defined with MODEM_CMUX_DEFINE()
+ * @param _name Name of CMUX instance
+ * @param _dlci_address Address of DLCI
+ */
+#define MODEM_CMUX_DLCI_GET(_name, _dlci_address) (&_name##_block.dlcis[(_dlci_address) - 1])
+
+/**
+ * @brief Get pipe of DLCI of CMUX instance defined with MODEM_CMUX_DEFINE()
+ * @param _name Name of CMUX instance
+ * @param _dlci_address Address of DLCI
+ */
+#define MODEM_CMUX_DLCI_PIPE_GET(_name, _dlci_address)                                            \
+	(&MODEM_CMUX_DLCI_GET(_name, _dlci_address)->pipe)
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,7 @@ extern "C" {
 #endif
 
 struct modem_pipe;
+struct net_buf;
 
 typedef int (*modem_pipe_api_open)(void *data);
 
@@ -22,6 +23,8 @@ typedef int (*modem_pipe_api_transmit)(void *data, const uint8_t *buf, size_t si
 
 typedef int (*modem_pipe_api_receive)(void *data, uint8_t *buf, size_t size);
 
+typedef int (*modem_pipe_api_receive_buf)(void *data, struct net_buf **buf);
+
 typedef int (*modem_pipe_api_close)(void *data);
 
 struct modem_pipe_api {
@@ -29,6 +32,7 @@ struct modem_pipe_api {
 	modem_pipe_api_transmit transmit;
 	modem_pipe_api_receive receive;
 	modem_pipe_api_close close;
+	modem_pipe_api_receive_buf receive_buf;
 };
 
 enum modem_pipe_state {
@@ -40,6 +44,8 @@ enum modem_pipe_event {
 	MODEM_PIPE_EVENT_OPENED = 0,
 	MODEM_PIPE_EVENT_RECEIVE_READY,
 	MODEM_PIPE_EVENT_CLOSED,
+	MODEM_PIPE_EVENT_SIGNALS_CHANGED,
+	MODEM_PIPE_EVENT_LINE_ERROR,
 };
 
 typedef void (*modem_pipe_api_callback)(struct modem_pipe *pipe, enum modem_pipe_event event,
@@ -101,6 +107,23 @@ int modem_pipe_transmit(struct modem_pipe *pipe, const uint8_t *buf, size_t size
  */
 int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size);
 
+/**
+ * @brief Receive data through pipe as network buffer
+ *
+ * @details Takes the oldest buffer of received data from pipes which deliver received
+ * data in network buffers, saving copying the data. The caller owns the reference to
+ * the buffer, and shall unreference it once processed.
+ *
+ * @param pipe Pipe to receive from
+ * @param buf Destination for received buffer
+ *
+ * @return 0 if buffer was received
+ * @return -EAGAIN if no buffer is ready
+ * @return -ENOTSUP if pipe does not deliver network buffers
+ * @return -EPERM if pipe is closed
+ */
+int modem_pipe_receive_buf(struct modem_pipe *pipe, struct net_buf **buf);
+
 /**
  * @brief Set callback
  */
@@ -120,6 +143,24 @@ void modem_pipe_notify_opened(struct modem_pipe *pipe);
 
 void modem_pipe_notify_closed(struct modem_pipe *pipe);
 
+/**
+ * @brief Notify that the line signals of the remote end of the pipe changed
+ *
+ * @param pipe Pipe whose remote line signals changed
+ *
+ * @warning Internal
+ */
+void modem_pipe_notify_signals_changed(struct modem_pipe *pipe);
+
+/**
+ * @brief Notify that the remote end of the pipe reported a line error
+ *
+ * @param pipe Pipe whose remote end reported a line error
+ *
+ * @warning Internal
+ */
+void modem_pipe_notify_line_error(struct modem_pipe *pipe);
+
 /**
  * @brief Notify of event
  *
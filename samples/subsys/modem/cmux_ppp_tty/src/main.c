@@ -64,6 +64,8 @@ static struct modem_pipe *dlci2_pipe;
 
 static uint8_t dlci1_receive_buf[128];
 static uint8_t dlci2_receive_buf[128];
+static uint8_t dlci1_transmit_buf[128];
+static uint8_t dlci2_transmit_buf[128];
 
 static void modem_cmux_callback_handler(struct modem_cmux *cmux, enum modem_cmux_event event,
 					void *user_data)
@@ -76,6 +78,9 @@ static void modem_cmux_callback_handler(struct modem_cmux *cmux, enum modem_cmux
 	case MODEM_CMUX_EVENT_DISCONNECTED:
 		k_event_post(&sample_event, SAMPLE_EVENT_CMUX_DISCONNECTED);
 		break;
+
+	default:
+		break;
 	}
 }
 
@@ -326,12 +331,16 @@ void main(void)
 		.dlci_address = 1,
 		.receive_buf = dlci1_receive_buf,
 		.receive_buf_size = ARRAY_SIZE(dlci1_receive_buf),
+		.transmit_buf = dlci1_transmit_buf,
+		.transmit_buf_size = ARRAY_SIZE(dlci1_transmit_buf),
 	};
 
 	const struct modem_cmux_dlci_config dlci2_config = {
 		.dlci_address = 2,
 		.receive_buf = dlci2_receive_buf,
 		.receive_buf_size = ARRAY_SIZE(dlci2_receive_buf),
+		.transmit_buf = dlci2_transmit_buf,
+		.transmit_buf_size = ARRAY_SIZE(dlci2_transmit_buf),
 	};
 
 	modem_cmux_init(&cmux, &cmux_config);
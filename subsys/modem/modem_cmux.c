@@ -8,11 +8,17 @@
 LOG_MODULE_REGISTER(modem_cmux);
 
 #include <zephyr/kernel.h>
-#include <zephyr/sys/crc.h>
 #include <zephyr/modem/cmux.h>
 
 #include <string.h>
 
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+#include <zephyr/shell/shell.h>
+
+static sys_slist_t modem_cmux_instances = SYS_SLIST_STATIC_INIT(&modem_cmux_instances);
+static K_MUTEX_DEFINE(modem_cmux_instances_lock);
+#endif
+
 #define MODEM_CMUX_FCS_POLYNOMIAL		(0xE0)
 #define MODEM_CMUX_FCS_INIT_VALUE		(0xFF)
 #define MODEM_CMUX_EA				(0x01)
@@ -20,18 +26,68 @@ LOG_MODULE_REGISTER(modem_cmux);
 #define MODEM_CMUX_PF				(0x10)
 #define MODEM_CMUX_FRAME_SIZE_MAX		(0x08)
 #define MODEM_CMUX_DATA_SIZE_MIN		(0x08)
-#define MODEM_CMUX_DATA_FRAME_SIZE_MIN		(MODEM_CMUX_FRAME_SIZE_MAX + \
-						 MODEM_CMUX_DATA_SIZE_MIN)
 
-#define MODEM_CMUX_CMD_DATA_SIZE_MAX		(0x04)
-#define MODEM_CMUX_CMD_FRAME_SIZE_MAX		(MODEM_CMUX_FRAME_SIZE_MAX + \
-						 MODEM_CMUX_CMD_DATA_SIZE_MAX)
+#define MODEM_CMUX_DATA_SIZE_DEFAULT		(127)
+
+#define MODEM_CMUX_RECEIVE_BUDGET_DEFAULT	(16)
+
+#define MODEM_CMUX_RECEIVE_BUFS_FREE_MIN	(1)
+
+#define MODEM_CMUX_ADVANCED_FLAG		(0x7E)
+#define MODEM_CMUX_ADVANCED_ESCAPE		(0x7D)
+#define MODEM_CMUX_ADVANCED_ESCAPE_MASK		(0x20)
+#define MODEM_CMUX_ADVANCED_XON			(0x11)
+#define MODEM_CMUX_ADVANCED_XOFF		(0x13)
+
+#define MODEM_CMUX_CMD_DATA_SIZE_MAX		(0x0A)
+
+#define MODEM_CMUX_T1_TIMEOUT_MS		(330)
+#define MODEM_CMUX_T1_MIN_TIMEOUT_MS		(10)
+#define MODEM_CMUX_T1_MAX_TIMEOUT_MS		(2550)
+#define MODEM_CMUX_T2_TIMEOUT_MS		(660)
+#define MODEM_CMUX_T3_TIMEOUT_MS		(10000)
+
+#define MODEM_CMUX_RESYNC_INTERVAL_MS		(MODEM_CMUX_T1_TIMEOUT_MS)
 
-#define MODEM_CMUX_T1_TIMEOUT			(K_MSEC(330))
-#define MODEM_CMUX_T2_TIMEOUT			(K_MSEC(660))
+#define MODEM_CMUX_KEEPALIVE_DATA_SIZE		(0x04)
+#define MODEM_CMUX_KEEPALIVE_MISSED_MAX		(CONFIG_MODEM_CMUX_KEEPALIVE_MISSED_MAX)
+
+#define MODEM_CMUX_WAKE_UP_FLAGS		(0x08)
+#define MODEM_CMUX_WAKE_UP_INTERVAL_MS		(10)
+#define MODEM_CMUX_WAKE_UP_ATTEMPTS_MAX		(MODEM_CMUX_T3_TIMEOUT_MS / \
+						 MODEM_CMUX_WAKE_UP_INTERVAL_MS)
+
+#define MODEM_CMUX_PN_DATA_SIZE			(0x08)
+#define MODEM_CMUX_PN_N2_DEFAULT		(0x03)
+#define MODEM_CMUX_PN_K_DEFAULT			(0x02)
+#define MODEM_CMUX_PN_FRAME_TYPE_UIH		(0x00)
+#define MODEM_CMUX_PN_FRAME_TYPE_UI		(0x01)
+#define MODEM_CMUX_PN_FRAME_TYPE_I		(0x02)
+
+#define MODEM_CMUX_SEQ_MASK			(0x07)
+#define MODEM_CMUX_WINDOW_SIZE_MAX		(0x07)
+
+#define MODEM_CMUX_SIGNALS_V24			(MODEM_CMUX_SIGNAL_RTC | MODEM_CMUX_SIGNAL_RTR | \
+						 MODEM_CMUX_SIGNAL_IC | MODEM_CMUX_SIGNAL_DV)
+
+#define MODEM_CMUX_LINE_STATUS_ERROR		(BIT(0))
+#define MODEM_CMUX_LINE_STATUS_ERRORS		(MODEM_CMUX_LINE_STATUS_OVERRUN | \
+						 MODEM_CMUX_LINE_STATUS_PARITY | \
+						 MODEM_CMUX_LINE_STATUS_FRAMING)
 
 #define MODEM_CMUX_EVENT_CONNECTED_BIT		(BIT(0))
 #define MODEM_CMUX_EVENT_DISCONNECTED_BIT	(BIT(1))
+#define MODEM_CMUX_EVENT_DLCIS_OPENED_BIT	(BIT(2))
+#define MODEM_CMUX_EVENT_DLCIS_CLOSED_BIT	(BIT(3))
+
+#if defined(CONFIG_MODEM_CMUX_STATISTICS)
+#define MODEM_CMUX_STATS_ADD(_owner, _field, _value) ((_owner)->stats._field += (_value))
+#define MODEM_CMUX_STATS_MAX(_owner, _field, _value)					\
+	((_owner)->stats._field = MAX((_owner)->stats._field, (_value)))
+#else
+#define MODEM_CMUX_STATS_ADD(_owner, _field, _value)
+#define MODEM_CMUX_STATS_MAX(_owner, _field, _value)
+#endif
 
 enum modem_cmux_frame_types {
 	MODEM_CMUX_FRAME_TYPE_RR = 0x01,
@@ -76,6 +132,54 @@ struct modem_cmux_command {
 	uint8_t value[];
 };
 
+/*
+ * FCS lookup table of reflected polynomial MODEM_CMUX_FCS_POLYNOMIAL, as listed in
+ * 3GPP TS 27.010, so the FCS over the data of UI and I frames costs one lookup per byte.
+ */
+static const uint8_t modem_cmux_fcs_table[256] = {
+	0x00, 0x91, 0xE3, 0x72, 0x07, 0x96, 0xE4, 0x75,
+	0x0E, 0x9F, 0xED, 0x7C, 0x09, 0x98, 0xEA, 0x7B,
+	0x1C, 0x8D, 0xFF, 0x6E, 0x1B, 0x8A, 0xF8, 0x69,
+	0x12, 0x83, 0xF1, 0x60, 0x15, 0x84, 0xF6, 0x67,
+	0x38, 0xA9, 0xDB, 0x4A, 0x3F, 0xAE, 0xDC, 0x4D,
+	0x36, 0xA7, 0xD5, 0x44, 0x31, 0xA0, 0xD2, 0x43,
+	0x24, 0xB5, 0xC7, 0x56, 0x23, 0xB2, 0xC0, 0x51,
+	0x2A, 0xBB, 0xC9, 0x58, 0x2D, 0xBC, 0xCE, 0x5F,
+	0x70, 0xE1, 0x93, 0x02, 0x77, 0xE6, 0x94, 0x05,
+	0x7E, 0xEF, 0x9D, 0x0C, 0x79, 0xE8, 0x9A, 0x0B,
+	0x6C, 0xFD, 0x8F, 0x1E, 0x6B, 0xFA, 0x88, 0x19,
+	0x62, 0xF3, 0x81, 0x10, 0x65, 0xF4, 0x86, 0x17,
+	0x48, 0xD9, 0xAB, 0x3A, 0x4F, 0xDE, 0xAC, 0x3D,
+	0x46, 0xD7, 0xA5, 0x34, 0x41, 0xD0, 0xA2, 0x33,
+	0x54, 0xC5, 0xB7, 0x26, 0x53, 0xC2, 0xB0, 0x21,
+	0x5A, 0xCB, 0xB9, 0x28, 0x5D, 0xCC, 0xBE, 0x2F,
+	0xE0, 0x71, 0x03, 0x92, 0xE7, 0x76, 0x04, 0x95,
+	0xEE, 0x7F, 0x0D, 0x9C, 0xE9, 0x78, 0x0A, 0x9B,
+	0xFC, 0x6D, 0x1F, 0x8E, 0xFB, 0x6A, 0x18, 0x89,
+	0xF2, 0x63, 0x11, 0x80, 0xF5, 0x64, 0x16, 0x87,
+	0xD8, 0x49, 0x3B, 0xAA, 0xDF, 0x4E, 0x3C, 0xAD,
+	0xD6, 0x47, 0x35, 0xA4, 0xD1, 0x40, 0x32, 0xA3,
+	0xC4, 0x55, 0x27, 0xB6, 0xC3, 0x52, 0x20, 0xB1,
+	0xCA, 0x5B, 0x29, 0xB8, 0xCD, 0x5C, 0x2E, 0xBF,
+	0x90, 0x01, 0x73, 0xE2, 0x97, 0x06, 0x74, 0xE5,
+	0x9E, 0x0F, 0x7D, 0xEC, 0x99, 0x08, 0x7A, 0xEB,
+	0x8C, 0x1D, 0x6F, 0xFE, 0x8B, 0x1A, 0x68, 0xF9,
+	0x82, 0x13, 0x61, 0xF0, 0x85, 0x14, 0x66, 0xF7,
+	0xA8, 0x39, 0x4B, 0xDA, 0xAF, 0x3E, 0x4C, 0xDD,
+	0xA6, 0x37, 0x45, 0xD4, 0xA1, 0x30, 0x42, 0xD3,
+	0xB4, 0x25, 0x57, 0xC6, 0xB3, 0x22, 0x50, 0xC1,
+	0xBA, 0x2B, 0x59, 0xC8, 0xBD, 0x2C, 0x5E, 0xCF,
+};
+
+static uint8_t modem_cmux_fcs_update(uint8_t fcs, const uint8_t *data, uint32_t data_len)
+{
+	for (uint32_t i = 0; i < data_len; i++) {
+		fcs = modem_cmux_fcs_table[fcs ^ data[i]];
+	}
+
+	return fcs;
+}
+
 static int modem_cmux_wrap_command(struct modem_cmux_command **command, const uint8_t *data,
 				   uint16_t data_len)
 {
@@ -126,943 +230,3913 @@ static void modem_cmux_raise_event(struct modem_cmux *cmux, enum modem_cmux_even
 	cmux->callback(cmux, event, cmux->user_data);
 }
 
-static void modem_cmux_bus_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
-				    void *user_data)
+/* Acknowledgement timer T1, adapted to measured round trip time if enabled */
+static k_timeout_t modem_cmux_t1_timeout(struct modem_cmux *cmux)
 {
-	struct modem_cmux *cmux = (struct modem_cmux *)user_data;
-
-	if (event == MODEM_PIPE_EVENT_RECEIVE_READY) {
-		k_work_schedule(&cmux->receive_work.dwork, K_NO_WAIT);
-	}
+	return K_MSEC(cmux->adaptive_t1_timeout_ms);
 }
 
-static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
-					  const struct modem_cmux_frame *frame)
+/* Response timer T2 of control channel commands */
+static uint32_t modem_cmux_t2_timeout_ms(struct modem_cmux *cmux)
 {
-	uint8_t byte;
-	uint8_t fcs;
-	uint16_t space;
-	uint16_t data_len;
-
-	space = ring_buf_space_get(&cmux->transmit_rb) - MODEM_CMUX_FRAME_SIZE_MAX;
-
-	data_len = (space < frame->data_len) ? space : frame->data_len;
-
-	/* SOF */
-	byte = 0xF9;
-
-	ring_buf_put(&cmux->transmit_rb, &byte, 1);
+	return MAX(cmux->t2_timeout_ms, cmux->adaptive_t1_timeout_ms * 2);
+}
 
-	/* DLCI Address (Max 63) */
-	byte = 0x01 | (frame->cr << 1) | (frame->dlci_address << 2);
+/* Maximum number of retransmissions N2 proposed to remote and used for I frames */
+static uint8_t modem_cmux_pn_n2(struct modem_cmux *cmux)
+{
+	return (cmux->n2 == 0) ? MODEM_CMUX_PN_N2_DEFAULT : cmux->n2;
+}
 
-	fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+/*
+ * Time to wait for CMUX connected or disconnected, or DLCIs opened or closed concurrently,
+ * allowing each command exchange T1 for the command and for each of its N2 retransmissions
+ */
+static uint32_t modem_cmux_dlcis_timeout_ms(struct modem_cmux *cmux, uint8_t exchanges)
+{
+	return cmux->adaptive_t1_timeout_ms * (modem_cmux_pn_n2(cmux) + 1) * exchanges;
+}
 
-	ring_buf_put(&cmux->transmit_rb, &byte, 1);
+/* SABM, DISC or CLD shall be transmitted unless N2 retransmissions have been answered */
+static bool modem_cmux_command_attempt(struct modem_cmux *cmux, uint8_t *attempts)
+{
+	if ((cmux->n2 > 0) && (*attempts > cmux->n2)) {
+		return false;
+	}
 
-	/* Frame type and poll/final */
-	byte = frame->type | (frame->pf << 4);
+	(*attempts)++;
 
-	fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+	return true;
+}
 
-	ring_buf_put(&cmux->transmit_rb, &byte, 1);
+/*
+ * Smoothed round trip time and its variation are estimated like TCP retransmission
+ * timeouts, using only responses to frames which were not retransmitted.
+ */
+static void modem_cmux_update_rtt(struct modem_cmux *cmux, uint32_t rtt_us)
+{
+	uint32_t deviation_us;
+	uint32_t t1_timeout_ms;
 
-	/* Data length */
-	if (127 < data_len) {
-		byte = data_len << 1;
+	if (cmux->adaptive_timeouts == false) {
+		return;
+	}
 
-		fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+	if (cmux->rtt_smoothed_us == 0) {
+		cmux->rtt_smoothed_us = rtt_us;
+		cmux->rtt_variation_us = rtt_us / 2;
+	} else {
+		deviation_us = (rtt_us < cmux->rtt_smoothed_us) ? cmux->rtt_smoothed_us - rtt_us
+								 : rtt_us - cmux->rtt_smoothed_us;
 
-		ring_buf_put(&cmux->transmit_rb, &byte, 1);
+		cmux->rtt_variation_us = ((cmux->rtt_variation_us * 3) + deviation_us) / 4;
+		cmux->rtt_smoothed_us = ((cmux->rtt_smoothed_us * 7) + rtt_us) / 8;
+	}
 
-		byte = 0x01 | (data_len >> 7);
+	t1_timeout_ms = DIV_ROUND_UP(cmux->rtt_smoothed_us + (cmux->rtt_variation_us * 4), 1000);
 
-		ring_buf_put(&cmux->transmit_rb, &byte, 1);
-	} else {
-		byte = 0x01 | (data_len << 1);
+	cmux->adaptive_t1_timeout_ms = CLAMP(t1_timeout_ms, MODEM_CMUX_T1_MIN_TIMEOUT_MS,
+					     MODEM_CMUX_T1_MAX_TIMEOUT_MS);
+}
 
-		ring_buf_put(&cmux->transmit_rb, &byte, 1);
+static void modem_cmux_update_command_rtt(struct modem_cmux *cmux, int64_t sent_ticks,
+					  uint8_t attempts)
+{
+	if (attempts == 1) {
+		modem_cmux_update_rtt(cmux, k_ticks_to_us_floor32(k_uptime_ticks() - sent_ticks));
 	}
+}
 
-	/* FCS final */
-	if (frame->type == MODEM_CMUX_FRAME_TYPE_UIH) {
-		fcs = 0xFF - crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
-	} else {
-		fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
-
-		fcs = 0xFF - crc8(frame->data, data_len, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+/* Restart idle timer after data has been transmitted or received on a DLCI */
+static void modem_cmux_power_save_restart(struct modem_cmux *cmux)
+{
+	if (cmux->power_save_timeout_ms == 0) {
+		return;
 	}
 
-	/* Data */
-	ring_buf_put(&cmux->transmit_rb, frame->data, data_len);
+	k_work_reschedule_for_queue(cmux->work_q, &cmux->power_save_work.dwork,
+				    K_MSEC(cmux->power_save_timeout_ms));
+}
 
-	/* FCS */
-	ring_buf_put(&cmux->transmit_rb, &fcs, 1);
+static void modem_cmux_power_save_reset(struct modem_cmux *cmux)
+{
+	cmux->power_save_requested = false;
+	cmux->power_saving = false;
+	cmux->power_save_entered = false;
+	cmux->waking = false;
+	cmux->receive_skip_flags = false;
+
+	k_work_cancel_delayable(&cmux->power_save_work.dwork);
+	k_work_cancel_delayable(&cmux->wake_up_work.dwork);
+}
 
-	/* EOF */
-	byte = 0xF9;
+/* Take pending power save entered event, called with transmit buffer lock held */
+static bool modem_cmux_power_save_entered_take(struct modem_cmux *cmux)
+{
+	bool entered = cmux->power_save_entered;
 
-	ring_buf_put(&cmux->transmit_rb, &byte, 1);
+	cmux->power_save_entered = false;
 
-	k_work_schedule(&cmux->transmit_work.dwork, K_NO_WAIT);
+	return entered;
+}
 
-	return data_len;
+static uint8_t modem_cmux_flag(struct modem_cmux *cmux)
+{
+	return (cmux->option == MODEM_CMUX_OPTION_ADVANCED) ? MODEM_CMUX_ADVANCED_FLAG : 0xF9;
 }
 
-static bool modem_cmux_transmit_cmd_frame(struct modem_cmux *cmux,
-					  const struct modem_cmux_frame *frame)
+static void modem_cmux_transmit_wake_up_flags(struct modem_cmux *cmux)
 {
-	uint16_t space;
+	uint8_t flags[MODEM_CMUX_WAKE_UP_FLAGS];
 
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	memset(flags, modem_cmux_flag(cmux), sizeof(flags));
 
-	space = ring_buf_space_get(&cmux->transmit_rb);
+	modem_pipe_transmit(cmux->pipe, flags, sizeof(flags));
+}
 
-	if (space < MODEM_CMUX_CMD_FRAME_SIZE_MAX) {
-		k_mutex_unlock(&cmux->transmit_rb_lock);
+static void modem_cmux_bus_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+				    void *user_data)
+{
+	struct modem_cmux *cmux = (struct modem_cmux *)user_data;
 
-		return false;
+	if (event == MODEM_PIPE_EVENT_RECEIVE_READY) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->receive_work.dwork, K_NO_WAIT);
 	}
-
-	modem_cmux_transmit_frame(cmux, frame);
-
-	k_mutex_unlock(&cmux->transmit_rb_lock);
-
-	return true;
 }
 
-static int16_t modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
-					      const struct modem_cmux_frame *frame)
+/* Worst case size of frame containing data_len bytes of data */
+static uint16_t modem_cmux_frame_size_max(struct modem_cmux *cmux, uint16_t data_len)
 {
-	uint16_t space;
-	int ret;
-
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	/* Every octet except the flags may be escaped in advanced option */
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		return MODEM_CMUX_FRAME_SIZE_MAX + (data_len * 2);
+	}
 
-	if (cmux->flow_control_on == false) {
-		k_mutex_unlock(&cmux->transmit_rb_lock);
+	return MODEM_CMUX_FRAME_SIZE_MAX + data_len;
+}
 
+/* Max number of data bytes which fits in frame of frame_size bytes, 0 if not even header fits */
+static uint16_t modem_cmux_frame_data_size_max(struct modem_cmux *cmux, uint16_t frame_size)
+{
+	if (frame_size < MODEM_CMUX_FRAME_SIZE_MAX) {
 		return 0;
 	}
 
-	space = ring_buf_space_get(&cmux->transmit_rb);
-
-	/*
-	 * Two command frames are reserved for command channel, and we shall prefer
-	 * waiting for more than MODEM_CMUX_DATA_FRAME_SIZE_MIN bytes available in the
-	 * transmit buffer rather than transmitting a few bytes at a time. This avoids
-	 * excessive wrapping overhead, since transmitting a single byte will require 8
-	 * bytes of wrapping.
-	 */
-	if (space < ((MODEM_CMUX_CMD_FRAME_SIZE_MAX * 2) + MODEM_CMUX_DATA_FRAME_SIZE_MIN)) {
-		k_mutex_unlock(&cmux->transmit_rb_lock);
+	frame_size -= MODEM_CMUX_FRAME_SIZE_MAX;
 
-		return -ENOMEM;
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		return frame_size / 2;
 	}
 
-	ret = modem_cmux_transmit_frame(cmux, frame);
-
-	k_mutex_unlock(&cmux->transmit_rb_lock);
-
-	return ret;
+	return frame_size;
 }
 
-static void modem_cmux_acknowledge_received_frame(struct modem_cmux *cmux)
+/* Max data size of received frames, the advanced option stores FCS in receive buffer */
+static uint16_t modem_cmux_receive_data_size_max(struct modem_cmux *cmux)
 {
-	struct modem_cmux_command *command;
-	struct modem_cmux_frame frame;
-	uint8_t data[MODEM_CMUX_CMD_DATA_SIZE_MAX];
-
-	if (sizeof(data) < cmux->frame.data_len) {
-		LOG_WRN("Command acknowledge buffer overrun");
-
-		return;
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		return cmux->receive_buf_size - 1;
 	}
 
-	memcpy(&frame, &cmux->frame, sizeof(cmux->frame));
-	memcpy(data, cmux->frame.data, cmux->frame.data_len);
-
-	modem_cmux_wrap_command(&command, data, cmux->frame.data_len);
-
-	command->type.cr = 0;
-	frame.data = data;
-	frame.data_len = cmux->frame.data_len;
-
-	if (modem_cmux_transmit_cmd_frame(cmux, &frame) == false) {
-		LOG_WRN("Command acknowledge buffer overrun");
-	}
+	return cmux->receive_buf_size;
 }
 
-static void modem_cmux_on_msc_command(struct modem_cmux *cmux)
+static bool modem_cmux_advanced_escape_required(uint8_t byte)
 {
-	modem_cmux_acknowledge_received_frame(cmux);
+	return (byte == MODEM_CMUX_ADVANCED_FLAG) || (byte == MODEM_CMUX_ADVANCED_ESCAPE) ||
+	       (byte == MODEM_CMUX_ADVANCED_XON) || (byte == MODEM_CMUX_ADVANCED_XOFF);
 }
 
-static void modem_cmux_on_fcon_command(struct modem_cmux *cmux)
+/*
+ * Octets which need no escaping are put into the transmit buffer in runs, so only
+ * the octets which must be escaped are handled individually.
+ */
+static void modem_cmux_transmit_escaped(struct modem_cmux *cmux, const uint8_t *data,
+					uint16_t data_len)
 {
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	uint8_t escaped[2];
+	uint16_t run;
+
+	while (data_len > 0) {
+		for (run = 0; run < data_len; run++) {
+			if (modem_cmux_advanced_escape_required(data[run]) == true) {
+				break;
+			}
+		}
 
-	cmux->flow_control_on = true;
+		ring_buf_put(&cmux->transmit_rb, data, run);
 
-	k_mutex_unlock(&cmux->transmit_rb_lock);
+		if (run == data_len) {
+			break;
+		}
 
-	modem_cmux_acknowledge_received_frame(cmux);
+		escaped[0] = MODEM_CMUX_ADVANCED_ESCAPE;
+		escaped[1] = data[run] ^ MODEM_CMUX_ADVANCED_ESCAPE_MASK;
+
+		ring_buf_put(&cmux->transmit_rb, escaped, sizeof(escaped));
+
+		data += run + 1;
+		data_len -= run + 1;
+	}
 }
 
-static void modem_cmux_on_fcoff_command(struct modem_cmux *cmux)
+static void modem_cmux_transmit_frame_data(struct modem_cmux *cmux, const uint8_t *data,
+					   uint16_t data_len)
 {
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
-
-	cmux->flow_control_on = false;
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		modem_cmux_transmit_escaped(cmux, data, data_len);
 
-	k_mutex_unlock(&cmux->transmit_rb_lock);
+		return;
+	}
 
-	modem_cmux_acknowledge_received_frame(cmux);
+	ring_buf_put(&cmux->transmit_rb, data, data_len);
 }
 
-static void modem_cmux_on_cld_command(struct modem_cmux *cmux)
+static uint16_t modem_cmux_encode_frame_header(const struct modem_cmux_frame *frame,
+					       uint16_t data_len, uint8_t *header)
 {
-	if (cmux->state != MODEM_CMUX_STATE_DISCONNECTING) {
-		LOG_WRN("Unexpected close down");
-	}
-
-	cmux->state = MODEM_CMUX_STATE_DISCONNECTED;
+	/* SOF */
+	header[0] = 0xF9;
 
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	/* DLCI Address (Max 63) */
+	header[1] = 0x01 | (frame->cr << 1) | (frame->dlci_address << 2);
 
-	cmux->flow_control_on = false;
+	/* Frame type and poll/final */
+	header[2] = frame->type | (frame->pf << 4);
 
-	k_mutex_unlock(&cmux->transmit_rb_lock);
+	/* Data length */
+	if (127 < data_len) {
+		header[3] = data_len << 1;
+		header[4] = 0x01 | (data_len >> 7);
 
-	k_work_cancel_delayable(&cmux->disconnect_work.dwork);
+		return 5;
+	}
 
-	modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DISCONNECTED);
+	header[3] = 0x01 | (data_len << 1);
 
-	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_CONNECTED_BIT);
-	k_event_post(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
+	return 4;
 }
 
-static void modem_cmux_on_control_frame_ua(struct modem_cmux *cmux)
+static uint8_t modem_cmux_transmit_frame_header(struct modem_cmux *cmux,
+						const struct modem_cmux_frame *frame,
+						uint16_t data_len)
 {
-	if (cmux->state != MODEM_CMUX_STATE_CONNECTING) {
-		LOG_DBG("Unexpected UA frame");
-
-		return;
-	}
+	uint8_t header[5];
+	uint16_t header_len;
 
-	cmux->state = MODEM_CMUX_STATE_CONNECTED;
-
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	header_len = modem_cmux_encode_frame_header(frame, data_len, header);
 
-	cmux->flow_control_on = true;
+	/* C/R bit is inverted for all frames transmitted by responder */
+	if (cmux->role == MODEM_CMUX_ROLE_RESPONDER) {
+		header[1] ^= 0x02;
+	}
 
-	k_mutex_unlock(&cmux->transmit_rb_lock);
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		/* Replace SOF and omit length field */
+		header[0] = MODEM_CMUX_ADVANCED_FLAG;
+		header_len = 3;
 
-	k_work_cancel_delayable(&cmux->connect_work.dwork);
+		ring_buf_put(&cmux->transmit_rb, header, 1);
 
-	modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_CONNECTED);
+		modem_cmux_transmit_escaped(cmux, &header[1], header_len - 1);
+	} else {
+		ring_buf_put(&cmux->transmit_rb, header, header_len);
+	}
 
-	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
-	k_event_post(&cmux->event, MODEM_CMUX_EVENT_CONNECTED_BIT);
+	/* FCS is computed over header excluding SOF */
+	return modem_cmux_fcs_update(MODEM_CMUX_FCS_INIT_VALUE, &header[1], header_len - 1);
 }
 
-static void modem_cmux_on_control_frame_uih(struct modem_cmux *cmux)
+static void modem_cmux_transmit_frame_trailer(struct modem_cmux *cmux, uint8_t fcs)
 {
-	struct modem_cmux_command *command;
+	uint8_t trailer;
 
-	if ((cmux->state != MODEM_CMUX_STATE_CONNECTED) &&
-	    (cmux->state != MODEM_CMUX_STATE_DISCONNECTING)) {
-		LOG_DBG("Unexpected UIH frame");
+	/* FCS */
+	trailer = 0xFF - fcs;
 
-		return;
-	}
+	modem_cmux_transmit_frame_data(cmux, &trailer, 1);
 
-	if (modem_cmux_wrap_command(&command, cmux->frame.data, cmux->frame.data_len) < 0) {
-		LOG_WRN("Invalid command");
+	/* EOF */
+	trailer = (cmux->option == MODEM_CMUX_OPTION_ADVANCED) ? MODEM_CMUX_ADVANCED_FLAG : 0xF9;
 
-		return;
-	}
+	ring_buf_put(&cmux->transmit_rb, &trailer, 1);
 
-	switch (command->type.value) {
-	case MODEM_CMUX_COMMAND_CLD:
-		modem_cmux_on_cld_command(cmux);
+	MODEM_CMUX_STATS_ADD(cmux, tx_frames, 1);
+	MODEM_CMUX_STATS_MAX(cmux, transmit_buf_max, ring_buf_size_get(&cmux->transmit_rb));
+}
 
-		break;
+static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
+					  const struct modem_cmux_frame *frame)
+{
+	uint8_t fcs;
+	uint16_t space;
+	uint16_t data_len;
 
-	case MODEM_CMUX_COMMAND_MSC:
-		modem_cmux_on_msc_command(cmux);
+	space = modem_cmux_frame_data_size_max(cmux, ring_buf_space_get(&cmux->transmit_rb));
 
-		break;
+	data_len = (space < frame->data_len) ? space : frame->data_len;
 
-	case MODEM_CMUX_COMMAND_FCON:
-		modem_cmux_on_fcon_command(cmux);
+	fcs = modem_cmux_transmit_frame_header(cmux, frame, data_len);
 
-		break;
+	if (frame->type != MODEM_CMUX_FRAME_TYPE_UIH) {
+		fcs = modem_cmux_fcs_update(fcs, frame->data, data_len);
+	}
 
-	case MODEM_CMUX_COMMAND_FCOFF:
-		modem_cmux_on_fcoff_command(cmux);
+	/* Data */
+	modem_cmux_transmit_frame_data(cmux, frame->data, data_len);
 
-		break;
+	modem_cmux_transmit_frame_trailer(cmux, fcs);
 
-	default:
-		LOG_DBG("Unknown command");
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
 
-		break;
-	}
+	return data_len;
 }
 
-static void modem_cmux_on_control_frame(struct modem_cmux *cmux)
+static bool modem_cmux_transmit_cmd_frame(struct modem_cmux *cmux,
+					  const struct modem_cmux_frame *frame)
 {
-	switch (cmux->frame.type) {
-	case MODEM_CMUX_FRAME_TYPE_UA:
-		modem_cmux_on_control_frame_ua(cmux);
+	uint16_t space;
 
-		break;
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
 
-	case MODEM_CMUX_FRAME_TYPE_UIH:
-		modem_cmux_on_control_frame_uih(cmux);
+	space = ring_buf_space_get(&cmux->transmit_rb);
 
-		break;
+	if (space < modem_cmux_frame_size_max(cmux, MODEM_CMUX_CMD_DATA_SIZE_MAX)) {
+		MODEM_CMUX_STATS_ADD(cmux, tx_rejected, 1);
 
-	default:
-		modem_cmux_log_unknown_frame(cmux);
+		k_mutex_unlock(&cmux->transmit_rb_lock);
 
-		break;
+		return false;
 	}
-}
 
-static struct modem_cmux_dlci *modem_cmux_find_dlci(struct modem_cmux *cmux)
-{
-	sys_snode_t *node;
-	struct modem_cmux_dlci *dlci;
+	modem_cmux_transmit_frame(cmux, frame);
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	return true;
+}
+
+static bool modem_cmux_transmit_msc_command(struct modem_cmux *cmux,
+					    struct modem_cmux_dlci *dlci, uint8_t signals)
+{
+	struct modem_cmux_command *command;
+	uint8_t data[4];
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = MODEM_CMUX_COMMAND_MSC;
+	command->length.ea = 1;
+	command->length.value = 2;
+	command->value[0] = 0x03 | (dlci->dlci_address << 2);
+	command->value[1] = 0x01 | signals;
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
+
+	return modem_cmux_transmit_cmd_frame(cmux, &frame);
+}
+
+static bool modem_cmux_transmit_rls_command(struct modem_cmux *cmux,
+					    struct modem_cmux_dlci *dlci, uint8_t line_status)
+{
+	struct modem_cmux_command *command;
+	uint8_t data[4];
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = MODEM_CMUX_COMMAND_RLS;
+	command->length.ea = 1;
+	command->length.value = 2;
+	command->value[0] = 0x03 | (dlci->dlci_address << 2);
+	command->value[1] = MODEM_CMUX_LINE_STATUS_ERROR | line_status;
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
+
+	return modem_cmux_transmit_cmd_frame(cmux, &frame);
+}
+
+static bool modem_cmux_transmit_psc_command(struct modem_cmux *cmux)
+{
+	struct modem_cmux_command *command;
+	uint8_t data[2];
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = MODEM_CMUX_COMMAND_PSC;
+	command->length.ea = 1;
+	command->length.value = 0;
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
+
+	return modem_cmux_transmit_cmd_frame(cmux, &frame);
+}
+
+static bool modem_cmux_transmit_test_command(struct modem_cmux *cmux, const uint8_t *value,
+					     uint8_t value_len)
+{
+	struct modem_cmux_command *command;
+	uint8_t data[2 + MODEM_CMUX_KEEPALIVE_DATA_SIZE];
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = MODEM_CMUX_COMMAND_TEST;
+	command->length.ea = 1;
+	command->length.value = value_len;
+	memcpy(command->value, value, value_len);
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = 2 + value_len,
+	};
+
+	return modem_cmux_transmit_cmd_frame(cmux, &frame);
+}
+
+static void modem_cmux_encode_pn_value(struct modem_cmux_dlci *dlci, uint8_t *value)
+{
+	/* DLCI */
+	value[0] = dlci->dlci_address & 0x3F;
+
+	/* UIH or I frames and convergence layer type 1 */
+	if (dlci->error_recovery == true) {
+		value[1] = MODEM_CMUX_PN_FRAME_TYPE_I;
+	} else if (dlci->ui_frames == true) {
+		value[1] = MODEM_CMUX_PN_FRAME_TYPE_UI;
+	} else {
+		value[1] = MODEM_CMUX_PN_FRAME_TYPE_UIH;
+	}
+
+	/* Priority */
+	value[2] = dlci->priority & 0x3F;
+
+	/* Acknowledgement timer T1 in units of 10ms */
+	value[3] = MIN(dlci->cmux->t1_timeout_ms / 10, 0xFF);
+
+	/* Max frame data size N1 */
+	value[4] = dlci->data_size_max & 0xFF;
+	value[5] = dlci->data_size_max >> 8;
+
+	/* Max number of retransmissions N2 */
+	value[6] = modem_cmux_pn_n2(dlci->cmux);
+
+	/* Window size k */
+	value[7] = dlci->window_size;
+}
+
+static bool modem_cmux_transmit_pn_command(struct modem_cmux *cmux,
+					   struct modem_cmux_dlci *dlci, bool cr)
+{
+	struct modem_cmux_command *command;
+	uint8_t data[2 + MODEM_CMUX_PN_DATA_SIZE];
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = cr;
+	command->type.value = MODEM_CMUX_COMMAND_PN;
+	command->length.ea = 1;
+	command->length.value = MODEM_CMUX_PN_DATA_SIZE;
+	modem_cmux_encode_pn_value(dlci, command->value);
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
+
+	return modem_cmux_transmit_cmd_frame(cmux, &frame);
+}
+
+static uint8_t modem_cmux_seq_next(uint8_t seq)
+{
+	return (seq + 1) & MODEM_CMUX_SEQ_MASK;
+}
+
+static uint8_t modem_cmux_seq_diff(uint8_t from, uint8_t to)
+{
+	return (to - from) & MODEM_CMUX_SEQ_MASK;
+}
+
+/*
+ * Data written to an idle DLCI is held back until coalesce_size bytes are queued, the
+ * coalescing window has elapsed, or the DLCI is flushed, to avoid framing a few bytes
+ * at a time when the application performs many small writes.
+ */
+static bool modem_cmux_dlci_coalescing(struct modem_cmux_dlci *dlci, uint32_t queued)
+{
+	if ((dlci->coalesce_timeout_ticks == 0) || (queued >= dlci->coalesce_size) ||
+	    (dlci->coalesce_flush == true)) {
+		return false;
+	}
+
+	return (k_uptime_ticks() - dlci->coalesce_start_ticks) < dlci->coalesce_timeout_ticks;
+}
+
+/* I frames are retransmitted until acknowledged, or new data fits in window */
+static bool modem_cmux_dlci_i_frame_ready(struct modem_cmux_dlci *dlci)
+{
+	uint32_t queued;
+
+	if (dlci->remote_busy == true) {
+		return false;
+	}
+
+	if (dlci->send_seq != dlci->send_seq_end) {
+		return true;
+	}
+
+	queued = ring_buf_size_get(&dlci->transmit_rb) - dlci->unacked_size;
+
+	return (modem_cmux_seq_diff(dlci->ack_seq, dlci->send_seq_end) < dlci->window_size) &&
+	       (queued > 0) && (modem_cmux_dlci_coalescing(dlci, queued) == false);
+}
+
+static bool modem_cmux_dlci_transmit_ready(struct modem_cmux_dlci *dlci)
+{
+	if ((dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) ||
+	    ((dlci->remote_signals & MODEM_CMUX_SIGNAL_FC) != 0)) {
+		return false;
+	}
+
+	if (dlci->error_recovery == true) {
+		return modem_cmux_dlci_i_frame_ready(dlci);
+	}
+
+	return (ring_buf_is_empty(&dlci->transmit_rb) == false) &&
+	       (modem_cmux_dlci_coalescing(dlci, ring_buf_size_get(&dlci->transmit_rb)) == false);
+}
+
+/* Get next DLCI in list after dlci, wrapping around to the first DLCI */
+static struct modem_cmux_dlci *modem_cmux_dlci_next(struct modem_cmux *cmux,
+						    struct modem_cmux_dlci *dlci)
+{
+	sys_snode_t *node;
+
+	node = (dlci == NULL) ? NULL : sys_slist_peek_next(&dlci->node);
+
+	if (node == NULL) {
+		node = sys_slist_peek_head(&cmux->dlcis);
+	}
+
+	return (struct modem_cmux_dlci *)node;
+}
+
+/*
+ * DLCIs with pending data are served in order of priority. DLCIs sharing the highest
+ * pending priority are served round robin, each transmitting up to weight frames in a
+ * row before yielding to the next.
+ */
+static struct modem_cmux_dlci *modem_cmux_transmit_schedule_dlci(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+	uint16_t priority = UINT16_MAX;
 
 	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
 		dlci = (struct modem_cmux_dlci *)node;
 
-		if (dlci->dlci_address == cmux->frame.dlci_address) {
-			return dlci;
-		}
-	}
+		if ((modem_cmux_dlci_transmit_ready(dlci) == true) && (dlci->priority < priority)) {
+			priority = dlci->priority;
+		}
+	}
+
+	if (priority == UINT16_MAX) {
+		return NULL;
+	}
+
+	/* Continue serving current DLCI until its credit is spent */
+	dlci = cmux->transmit_dlci;
+
+	if ((dlci != NULL) && (dlci->transmit_credit > 0) && (dlci->priority == priority) &&
+	    (modem_cmux_dlci_transmit_ready(dlci) == true)) {
+		dlci->transmit_credit--;
+
+		return dlci;
+	}
+
+	/* Find next DLCI with pending data and highest priority */
+	dlci = modem_cmux_dlci_next(cmux, cmux->transmit_dlci);
+
+	while ((modem_cmux_dlci_transmit_ready(dlci) == false) || (dlci->priority != priority)) {
+		dlci = modem_cmux_dlci_next(cmux, dlci);
+	}
+
+	cmux->transmit_dlci = dlci;
+	dlci->transmit_credit = dlci->weight - 1;
+
+	return dlci;
+}
+
+/*
+ * Copy frame data, starting offset bytes into the DLCI transmit queue, which may wrap,
+ * into transmit buffer. Data of I frames is kept in the queue until acknowledged.
+ */
+static void modem_cmux_transmit_dlci_frame(struct modem_cmux *cmux, struct modem_cmux_dlci *dlci,
+					   const struct modem_cmux_frame *frame, uint16_t offset)
+{
+	uint8_t fcs;
+	uint8_t *data;
+	uint16_t data_len = frame->data_len;
+	uint32_t claimed;
+
+	fcs = modem_cmux_transmit_frame_header(cmux, frame, data_len);
+
+	modem_cmux_power_save_restart(cmux);
+
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
+
+	while (offset > 0) {
+		claimed = ring_buf_get_claim(&dlci->transmit_rb, &data, offset);
+
+		offset -= claimed;
+	}
+
+	while (data_len > 0) {
+		claimed = ring_buf_get_claim(&dlci->transmit_rb, &data, data_len);
+
+		if (frame->type != MODEM_CMUX_FRAME_TYPE_UIH) {
+			fcs = modem_cmux_fcs_update(fcs, data, claimed);
+		}
+
+		modem_cmux_transmit_frame_data(cmux, data, claimed);
+
+		data_len -= claimed;
+	}
+
+	ring_buf_get_finish(&dlci->transmit_rb,
+			    (dlci->error_recovery == true) ? 0 : frame->data_len);
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	MODEM_CMUX_STATS_ADD(dlci, tx_frames, 1);
+	MODEM_CMUX_STATS_ADD(dlci, tx_bytes, frame->data_len);
+
+	modem_cmux_transmit_frame_trailer(cmux, fcs);
+}
+
+/* Transmit next I frame, either retransmitting an unacknowledged frame or new data */
+static bool modem_cmux_transmit_dlci_i_frame(struct modem_cmux *cmux,
+					     struct modem_cmux_dlci *dlci, uint16_t space)
+{
+	uint16_t offset = 0;
+	uint16_t data_len;
+
+	for (uint8_t seq = dlci->ack_seq; seq != dlci->send_seq; seq = modem_cmux_seq_next(seq)) {
+		offset += dlci->unacked_len[seq];
+	}
+
+	if (dlci->send_seq != dlci->send_seq_end) {
+		data_len = dlci->unacked_len[dlci->send_seq];
+
+		/* Retransmitted frames can not be split */
+		if (space < data_len) {
+			return false;
+		}
+	} else {
+		data_len = ring_buf_size_get(&dlci->transmit_rb) - dlci->unacked_size;
+
+		data_len = (dlci->data_size_max < data_len) ? dlci->data_size_max : data_len;
+
+		data_len = (space < data_len) ? space : data_len;
+
+		dlci->unacked_len[dlci->send_seq] = data_len;
+		dlci->unacked_size += data_len;
+		dlci->send_seq_end = modem_cmux_seq_next(dlci->send_seq_end);
+	}
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = dlci->dlci_address,
+		.cr = true,
+		.pf = false,
+		.type = (dlci->send_seq << 1) | (dlci->receive_seq << 5),
+		.data = NULL,
+		.data_len = data_len,
+	};
+
+	modem_cmux_transmit_dlci_frame(cmux, dlci, &frame, offset);
+
+	dlci->send_seq = modem_cmux_seq_next(dlci->send_seq);
+
+	/* Received frames are acknowledged by N(R) of I frame */
+	dlci->ack_pending = false;
+
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->retransmit_work.dwork,
+				  modem_cmux_t1_timeout(cmux));
+
+	return true;
+}
+
+/*
+ * Two command frames are reserved for command channel, and we shall prefer
+ * waiting for a frame with MODEM_CMUX_DATA_SIZE_MIN bytes of data to fit in the
+ * transmit buffer rather than transmitting a few bytes at a time. This avoids
+ * excessive wrapping overhead, since transmitting a single byte will require 8
+ * bytes of wrapping. Likewise, data queued on a DLCI is segmented into frames of
+ * N1 bytes, waiting for room rather than splitting it into shorter frames while
+ * the transmit buffer is being drained.
+ */
+static void modem_cmux_transmit_data_frames(struct modem_cmux *cmux)
+{
+	struct modem_cmux_dlci *dlci;
+	uint16_t cmd_frame_size_max;
+	uint16_t space;
+	uint16_t data_len;
+
+	if (cmux->flow_control_on == false) {
+		return;
+	}
+
+	cmd_frame_size_max = modem_cmux_frame_size_max(cmux, MODEM_CMUX_CMD_DATA_SIZE_MAX);
+
+	while (true) {
+		space = ring_buf_space_get(&cmux->transmit_rb);
+
+		if (space < ((cmd_frame_size_max * 2) +
+			     modem_cmux_frame_size_max(cmux, MODEM_CMUX_DATA_SIZE_MIN))) {
+			break;
+		}
+
+		dlci = modem_cmux_transmit_schedule_dlci(cmux);
+
+		if (dlci == NULL) {
+			break;
+		}
+
+		space = modem_cmux_frame_data_size_max(cmux, space - (cmd_frame_size_max * 2));
+
+		if (dlci->error_recovery == true) {
+			if (modem_cmux_transmit_dlci_i_frame(cmux, dlci, space) == false) {
+				break;
+			}
+
+			continue;
+		}
+
+		data_len = ring_buf_size_get(&dlci->transmit_rb);
+
+		data_len = (dlci->data_size_max < data_len) ? dlci->data_size_max : data_len;
+
+		/* Wait for room for a full frame rather than splitting data into short frames */
+		if ((space < data_len) && (ring_buf_is_empty(&cmux->transmit_rb) == false)) {
+			dlci->transmit_credit++;
+			break;
+		}
+
+		data_len = (space < data_len) ? space : data_len;
+
+		struct modem_cmux_frame frame = {
+			.dlci_address = dlci->dlci_address,
+			.cr = false,
+			.pf = false,
+			.type = (dlci->ui_frames == true) ? MODEM_CMUX_FRAME_TYPE_UI
+							  : MODEM_CMUX_FRAME_TYPE_UIH,
+			.data = NULL,
+			.data_len = data_len,
+		};
+
+		modem_cmux_transmit_dlci_frame(cmux, dlci, &frame, 0);
+	}
+}
+
+/* Acknowledge received I frames not acknowledged by transmitted I frames */
+static void modem_cmux_transmit_supervisory_frames(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+	uint8_t type;
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		if ((dlci->ack_pending == false) || (dlci->state != MODEM_CMUX_DLCI_STATE_OPEN)) {
+			continue;
+		}
+
+		if (ring_buf_space_get(&cmux->transmit_rb) < modem_cmux_frame_size_max(cmux, 0)) {
+			break;
+		}
+
+		if (dlci->reject_pending == true) {
+			type = MODEM_CMUX_FRAME_TYPE_REJ;
+		} else if (dlci->local_busy == true) {
+			type = MODEM_CMUX_FRAME_TYPE_RNR;
+		} else {
+			type = MODEM_CMUX_FRAME_TYPE_RR;
+		}
+
+		struct modem_cmux_frame frame = {
+			.dlci_address = dlci->dlci_address,
+			.cr = false,
+			.pf = dlci->final_pending,
+			.type = type | (dlci->receive_seq << 5),
+			.data = NULL,
+			.data_len = 0,
+		};
+
+		modem_cmux_transmit_frame(cmux, &frame);
+
+		dlci->ack_pending = false;
+		dlci->reject_pending = false;
+		dlci->final_pending = false;
+	}
+}
+
+static bool modem_cmux_transmit_data_pending(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+
+	if (cmux->flow_control_on == false) {
+		return false;
+	}
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		if (modem_cmux_dlci_transmit_ready((struct modem_cmux_dlci *)node) == true) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Resume transmitting once the first coalescing window of any DLCI elapses */
+static void modem_cmux_transmit_schedule_coalesced(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+	int64_t remaining;
+	int64_t timeout = INT64_MAX;
+
+	if (cmux->flow_control_on == false) {
+		return;
+	}
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		if ((dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) ||
+		    (dlci->coalesce_timeout_ticks == 0) ||
+		    (ring_buf_size_get(&dlci->transmit_rb) <= dlci->unacked_size)) {
+			continue;
+		}
+
+		remaining = dlci->coalesce_start_ticks + dlci->coalesce_timeout_ticks -
+			    k_uptime_ticks();
+
+		timeout = (remaining < timeout) ? remaining : timeout;
+	}
+
+	if (timeout == INT64_MAX) {
+		return;
+	}
+
+	k_work_reschedule_for_queue(cmux->work_q, &cmux->coalesce_work.dwork,
+				    K_TICKS((timeout < 0) ? 0 : timeout));
+}
+
+static void modem_cmux_acknowledge_received_frame(struct modem_cmux *cmux)
+{
+	struct modem_cmux_command *command;
+	struct modem_cmux_frame frame;
+	uint8_t data[MODEM_CMUX_CMD_DATA_SIZE_MAX];
+
+	if (sizeof(data) < cmux->frame.data_len) {
+		LOG_WRN("Command acknowledge buffer overrun");
+
+		return;
+	}
+
+	memcpy(&frame, &cmux->frame, sizeof(cmux->frame));
+	memcpy(data, cmux->frame.data, cmux->frame.data_len);
+
+	modem_cmux_wrap_command(&command, data, cmux->frame.data_len);
+
+	command->type.cr = 0;
+	frame.cr = false;
+	frame.data = data;
+	frame.data_len = cmux->frame.data_len;
+
+	if (modem_cmux_transmit_cmd_frame(cmux, &frame) == false) {
+		LOG_WRN("Command acknowledge buffer overrun");
+	}
+}
+
+/* Answer SABM or DISC frame received from remote with UA or DM frame */
+static void modem_cmux_transmit_response(struct modem_cmux *cmux, uint8_t type)
+{
+	struct modem_cmux_frame frame = {
+		.dlci_address = cmux->frame.dlci_address,
+		.cr = false,
+		.pf = cmux->frame.pf,
+		.type = type,
+		.data = NULL,
+		.data_len = 0,
+	};
+
+	if (modem_cmux_transmit_cmd_frame(cmux, &frame) == false) {
+		LOG_WRN("Response buffer overrun");
+	}
+}
+
+/* DLCIs are added and removed at runtime with the transmit buffer lock held */
+static struct modem_cmux_dlci *modem_cmux_find_dlci(struct modem_cmux *cmux,
+						    uint16_t dlci_address)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci = NULL;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if (dlci_address < cmux->dlci_table_size) {
+		dlci = cmux->dlci_table[dlci_address];
+
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		return dlci;
+	}
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		if (((struct modem_cmux_dlci *)node)->dlci_address == dlci_address) {
+			dlci = (struct modem_cmux_dlci *)node;
+
+			break;
+		}
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	return dlci;
+}
+
+static void modem_cmux_on_msc_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	struct modem_cmux_dlci *dlci;
+	uint8_t signals;
+	uint8_t changed;
+
+	if (command->type.cr == 0) {
+		LOG_DBG("MSC response");
+
+		return;
+	}
+
+	modem_cmux_acknowledge_received_frame(cmux);
+
+	if (command->length.value < 2) {
+		LOG_WRN("Invalid MSC command");
+
+		return;
+	}
+
+	dlci = modem_cmux_find_dlci(cmux, (command->value[0] >> 2) & 0x3F);
+
+	if (dlci == NULL) {
+		LOG_DBG("MSC for unknown DLCI");
+
+		return;
+	}
+
+	signals = command->value[1] & (MODEM_CMUX_SIGNAL_FC | MODEM_CMUX_SIGNALS_V24);
+
+	changed = dlci->remote_signals ^ signals;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	dlci->remote_signals = signals;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	/* Resume transmitting data queued for DLCI */
+	if ((changed & MODEM_CMUX_SIGNAL_FC) && ((signals & MODEM_CMUX_SIGNAL_FC) == 0)) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+	}
+
+	if (changed & MODEM_CMUX_SIGNALS_V24) {
+		modem_pipe_notify_signals_changed(&dlci->pipe);
+	}
+}
+
+static void modem_cmux_on_rls_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	struct modem_cmux_dlci *dlci;
+	uint8_t line_status;
+
+	if (command->type.cr == 0) {
+		LOG_DBG("RLS response");
+
+		return;
+	}
+
+	modem_cmux_acknowledge_received_frame(cmux);
+
+	if (command->length.value < 2) {
+		LOG_WRN("Invalid RLS command");
+
+		return;
+	}
+
+	dlci = modem_cmux_find_dlci(cmux, (command->value[0] >> 2) & 0x3F);
+
+	if (dlci == NULL) {
+		LOG_DBG("RLS for unknown DLCI");
+
+		return;
+	}
+
+	/* Error type is only valid if error is indicated */
+	if ((command->value[1] & MODEM_CMUX_LINE_STATUS_ERROR) == 0) {
+		return;
+	}
+
+	line_status = command->value[1] & MODEM_CMUX_LINE_STATUS_ERRORS;
+
+	LOG_WRN("DLCI %u line error 0x%02x reported by remote", dlci->dlci_address,
+		line_status);
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	dlci->remote_line_status |= line_status;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	modem_pipe_notify_line_error(&dlci->pipe);
+}
+
+static void modem_cmux_on_pn_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	struct modem_cmux_dlci *dlci;
+	uint16_t data_size_max;
+
+	if (command->length.value != MODEM_CMUX_PN_DATA_SIZE) {
+		LOG_WRN("Invalid PN command");
+
+		return;
+	}
+
+	dlci = modem_cmux_find_dlci(cmux, command->value[0] & 0x3F);
+
+	if (dlci == NULL) {
+		LOG_DBG("PN for unknown DLCI");
+
+		return;
+	}
+
+	data_size_max = ((uint16_t)command->value[5] << 8) | command->value[4];
+
+	/* Frames larger than receive buffer can not be received */
+	if ((data_size_max == 0) || (data_size_max > modem_cmux_receive_data_size_max(cmux))) {
+		data_size_max = modem_cmux_receive_data_size_max(cmux);
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	dlci->priority = command->value[2] & 0x3F;
+
+	dlci->data_size_max = (data_size_max < dlci->data_size_max) ? data_size_max
+								     : dlci->data_size_max;
+
+	if ((dlci->error_recovery == true) && (command->type.cr == 0) &&
+	    ((command->value[1] & 0x0F) != MODEM_CMUX_PN_FRAME_TYPE_I)) {
+		LOG_WRN("DLCI %u error recovery mode rejected by remote", dlci->dlci_address);
+
+		dlci->error_recovery = false;
+	}
+
+	/* Frame type proposed by remote is used, as is frame type accepted by remote */
+	if (dlci->error_recovery == false) {
+		dlci->ui_frames = ((command->value[1] & 0x0F) == MODEM_CMUX_PN_FRAME_TYPE_UI);
+	}
+
+	if (((command->value[7] & MODEM_CMUX_WINDOW_SIZE_MAX) != 0) &&
+	    ((command->value[7] & MODEM_CMUX_WINDOW_SIZE_MAX) < dlci->window_size)) {
+		dlci->window_size = command->value[7] & MODEM_CMUX_WINDOW_SIZE_MAX;
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	LOG_DBG("DLCI %u N1: %u, priority: %u", dlci->dlci_address, dlci->data_size_max,
+		dlci->priority);
+
+	/* Answer parameters proposed by remote with accepted parameters */
+	if (command->type.cr == 1) {
+		modem_cmux_transmit_pn_command(cmux, dlci, false);
+
+		return;
+	}
+
+	if (dlci->state != MODEM_CMUX_DLCI_STATE_NEGOTIATING) {
+		LOG_DBG("Unexpected PN response");
+
+		return;
+	}
+
+	/* Parameters agreed, open DLCI */
+	dlci->state = MODEM_CMUX_DLCI_STATE_OPENING;
+	dlci->command_attempts = 0;
+
+	k_work_reschedule_for_queue(dlci->cmux->work_q, &dlci->open_work.dwork, K_NO_WAIT);
+}
+
+static void modem_cmux_on_nsc_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+
+	if ((command->length.value >= 1) &&
+	    (((command->value[0] >> 2) & 0x3F) == MODEM_CMUX_COMMAND_PSC)) {
+		LOG_WRN("Power saving not supported by remote");
+
+		cmux->power_save_timeout_ms = 0;
+
+		return;
+	}
+
+	if ((command->length.value < 1) ||
+	    (((command->value[0] >> 2) & 0x3F) != MODEM_CMUX_COMMAND_PN)) {
+		LOG_DBG("Command not supported by remote");
+
+		return;
+	}
+
+	/* Open DLCIs awaiting PN response using default parameters */
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		if (dlci->state == MODEM_CMUX_DLCI_STATE_NEGOTIATING) {
+			dlci->state = MODEM_CMUX_DLCI_STATE_OPENING;
+			dlci->command_attempts = 0;
+
+			k_work_reschedule_for_queue(dlci->cmux->work_q, &dlci->open_work.dwork,
+						    K_NO_WAIT);
+		}
+	}
+}
+
+/*
+ * Power saving is entered once the PSC response has been transmitted, or once the PSC
+ * command transmitted by us has been answered.
+ */
+static void modem_cmux_on_psc_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	if (command->type.cr == 1) {
+		modem_cmux_acknowledge_received_frame(cmux);
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	cmux->power_save_requested = true;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+}
+
+static void modem_cmux_encode_keepalive_value(uint32_t seq, uint8_t *value)
+{
+	value[0] = seq & 0xFF;
+	value[1] = (seq >> 8) & 0xFF;
+	value[2] = (seq >> 16) & 0xFF;
+	value[3] = seq >> 24;
+}
+
+static void modem_cmux_on_keepalive_response(struct modem_cmux *cmux,
+					     struct modem_cmux_command *command)
+{
+	struct modem_cmux_keepalive_stats *stats = &cmux->keepalive_stats;
+	uint8_t value[MODEM_CMUX_KEEPALIVE_DATA_SIZE];
+	uint32_t rtt_us;
+
+	modem_cmux_encode_keepalive_value(cmux->keepalive_seq, value);
+
+	/* Validate echoed payload matches outstanding TEST command */
+	if ((cmux->keepalive_pending == false) ||
+	    (command->length.value != MODEM_CMUX_KEEPALIVE_DATA_SIZE) ||
+	    (memcmp(command->value, value, sizeof(value)) != 0)) {
+		LOG_WRN("Unexpected TEST response");
+
+		return;
+	}
+
+	rtt_us = k_ticks_to_us_floor32(k_uptime_ticks() - cmux->keepalive_sent_ticks);
+
+	cmux->keepalive_pending = false;
+	cmux->keepalive_missed = 0;
+
+	stats->rtt_min_us = ((stats->received == 0) || (rtt_us < stats->rtt_min_us))
+			  ? rtt_us
+			  : stats->rtt_min_us;
+
+	stats->rtt_max_us = (rtt_us > stats->rtt_max_us) ? rtt_us : stats->rtt_max_us;
+
+	stats->received++;
+	cmux->keepalive_rtt_sum_us += rtt_us;
+	stats->rtt_avg_us = cmux->keepalive_rtt_sum_us / stats->received;
+
+	LOG_DBG("TEST response, RTT %u us", rtt_us);
+
+	modem_cmux_update_rtt(cmux, rtt_us);
+
+	k_work_reschedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork,
+				    K_MSEC(cmux->keepalive_interval_ms));
+}
+
+static void modem_cmux_on_test_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	/* Echo TEST command from remote */
+	if (command->type.cr == 1) {
+		modem_cmux_acknowledge_received_frame(cmux);
+
+		return;
+	}
+
+	modem_cmux_on_keepalive_response(cmux, command);
+}
+
+static void modem_cmux_on_fcon_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	if (command->type.cr == 0) {
+		LOG_DBG("FCON response");
+
+		return;
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	cmux->flow_control_on = true;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	modem_cmux_acknowledge_received_frame(cmux);
+
+	/* Resume transmitting queued data */
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+}
+
+static void modem_cmux_on_fcoff_command(struct modem_cmux *cmux,
+					struct modem_cmux_command *command)
+{
+	if (command->type.cr == 0) {
+		LOG_DBG("FCOFF response");
+
+		return;
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	cmux->flow_control_on = false;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	modem_cmux_acknowledge_received_frame(cmux);
+}
+
+static void modem_cmux_on_disconnected(struct modem_cmux *cmux)
+{
+	cmux->state = MODEM_CMUX_STATE_DISCONNECTED;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	cmux->flow_control_on = false;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_cancel_delayable(&cmux->disconnect_work.dwork);
+
+	modem_cmux_power_save_reset(cmux);
+
+	k_work_cancel_delayable(&cmux->keepalive_work.dwork);
+
+	modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DISCONNECTED);
+
+	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_CONNECTED_BIT);
+	k_event_post(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
+}
+
+static void modem_cmux_on_cld_command(struct modem_cmux *cmux, struct modem_cmux_command *command)
+{
+	/* Close down requested by remote */
+	if (command->type.cr == 1) {
+		modem_cmux_acknowledge_received_frame(cmux);
+	} else if (cmux->state != MODEM_CMUX_STATE_DISCONNECTING) {
+		LOG_WRN("Unexpected close down");
+	} else {
+		modem_cmux_update_command_rtt(cmux, cmux->command_sent_ticks,
+					      cmux->command_attempts);
+	}
+
+	modem_cmux_on_disconnected(cmux);
+}
+
+static void modem_cmux_on_connected(struct modem_cmux *cmux)
+{
+	cmux->state = MODEM_CMUX_STATE_CONNECTED;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	cmux->flow_control_on = true;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_cancel_delayable(&cmux->connect_work.dwork);
+
+	modem_cmux_power_save_restart(cmux);
+
+	if (cmux->keepalive_interval_ms > 0) {
+		cmux->keepalive_pending = false;
+		cmux->keepalive_missed = 0;
+
+		k_work_schedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork,
+					  K_MSEC(cmux->keepalive_interval_ms));
+	}
+
+	modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_CONNECTED);
+
+	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
+	k_event_post(&cmux->event, MODEM_CMUX_EVENT_CONNECTED_BIT);
+}
+
+static void modem_cmux_on_control_frame_ua(struct modem_cmux *cmux)
+{
+	if (cmux->state != MODEM_CMUX_STATE_CONNECTING) {
+		LOG_DBG("Unexpected UA frame");
+
+		return;
+	}
+
+	modem_cmux_update_command_rtt(cmux, cmux->command_sent_ticks, cmux->command_attempts);
+
+	modem_cmux_on_connected(cmux);
+}
+
+/* Connect request from initiator, answered once listening */
+static void modem_cmux_on_control_frame_sabm(struct modem_cmux *cmux)
+{
+	if (cmux->role != MODEM_CMUX_ROLE_RESPONDER) {
+		modem_cmux_log_unknown_frame(cmux);
+
+		return;
+	}
+
+	switch (cmux->state) {
+	case MODEM_CMUX_STATE_CONNECTING:
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+		modem_cmux_on_connected(cmux);
+
+		break;
+
+	case MODEM_CMUX_STATE_CONNECTED:
+		/* UA frame lost, answer retransmitted SABM */
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+		break;
+
+	default:
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_DM);
+
+		break;
+	}
+}
+
+/* DISC on control channel is equivalent to the CLD command */
+static void modem_cmux_on_control_frame_disc(struct modem_cmux *cmux)
+{
+	if ((cmux->state != MODEM_CMUX_STATE_CONNECTED) &&
+	    (cmux->state != MODEM_CMUX_STATE_DISCONNECTING)) {
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_DM);
+
+		return;
+	}
+
+	modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+	modem_cmux_on_disconnected(cmux);
+}
+
+static void modem_cmux_on_control_frame_uih(struct modem_cmux *cmux)
+{
+	struct modem_cmux_command *command;
+
+	if ((cmux->state != MODEM_CMUX_STATE_CONNECTED) &&
+	    (cmux->state != MODEM_CMUX_STATE_DISCONNECTING)) {
+		LOG_DBG("Unexpected UIH frame");
+
+		return;
+	}
+
+	if (modem_cmux_wrap_command(&command, cmux->frame.data, cmux->frame.data_len) < 0) {
+		LOG_WRN("Invalid command");
+
+		return;
+	}
+
+	switch (command->type.value) {
+	case MODEM_CMUX_COMMAND_CLD:
+		modem_cmux_on_cld_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_MSC:
+		modem_cmux_on_msc_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_RLS:
+		modem_cmux_on_rls_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_PN:
+		modem_cmux_on_pn_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_NSC:
+		modem_cmux_on_nsc_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_PSC:
+		modem_cmux_on_psc_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_TEST:
+		modem_cmux_on_test_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_FCON:
+		modem_cmux_on_fcon_command(cmux, command);
+
+		break;
+
+	case MODEM_CMUX_COMMAND_FCOFF:
+		modem_cmux_on_fcoff_command(cmux, command);
+
+		break;
+
+	default:
+		LOG_DBG("Unknown command");
+
+		break;
+	}
+}
+
+static void modem_cmux_on_control_frame(struct modem_cmux *cmux)
+{
+	switch (cmux->frame.type) {
+	case MODEM_CMUX_FRAME_TYPE_UA:
+		modem_cmux_on_control_frame_ua(cmux);
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_UI:
+	case MODEM_CMUX_FRAME_TYPE_UIH:
+		modem_cmux_on_control_frame_uih(cmux);
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_SABM:
+		modem_cmux_on_control_frame_sabm(cmux);
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_DISC:
+		modem_cmux_on_control_frame_disc(cmux);
+
+		break;
+
+	default:
+		modem_cmux_log_unknown_frame(cmux);
+
+		break;
+	}
+}
+
+/* Allocate receive and transmit buffers from slab, unless already allocated */
+static int modem_cmux_dlci_alloc_bufs(struct modem_cmux_dlci *dlci)
+{
+	void *receive_block;
+	void *transmit_block;
+
+	if ((dlci->buf_slab == NULL) || (dlci->receive_block != NULL)) {
+		return 0;
+	}
+
+	if (k_mem_slab_alloc(dlci->buf_slab, &receive_block, K_NO_WAIT) < 0) {
+		return -ENOMEM;
+	}
+
+	if (k_mem_slab_alloc(dlci->buf_slab, &transmit_block, K_NO_WAIT) < 0) {
+		k_mem_slab_free(dlci->buf_slab, receive_block);
+
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	dlci->receive_block = receive_block;
+	ring_buf_init(&dlci->receive_rb, dlci->receive_buf_size, dlci->receive_block);
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
+
+	dlci->transmit_block = transmit_block;
+	ring_buf_init(&dlci->transmit_rb, dlci->transmit_buf_size, dlci->transmit_block);
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	return 0;
+}
+
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+/* Release received data queued in network buffers */
+static void modem_cmux_dlci_receive_bufs_free(struct modem_cmux_dlci *dlci)
+{
+	sys_snode_t *node;
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	while ((node = sys_slist_get(&dlci->receive_bufs)) != NULL) {
+		net_buf_unref(CONTAINER_OF(node, struct net_buf, node));
+	}
+
+	dlci->receive_bufs_len = 0;
+	dlci->receive_bufs_count = 0;
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+}
+#endif
+
+/*
+ * Release queued network buffers, and return buffers allocated from slab, leaving DLCI
+ * without buffers until opened again
+ */
+static void modem_cmux_dlci_free_bufs(struct modem_cmux_dlci *dlci)
+{
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	modem_cmux_dlci_receive_bufs_free(dlci);
+#endif
+
+	if (dlci->receive_block == NULL) {
+		return;
+	}
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	ring_buf_init(&dlci->receive_rb, 0, NULL);
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
+
+	ring_buf_init(&dlci->transmit_rb, 0, NULL);
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	k_mem_slab_free(dlci->buf_slab, dlci->receive_block);
+	k_mem_slab_free(dlci->buf_slab, dlci->transmit_block);
+
+	dlci->receive_block = NULL;
+	dlci->transmit_block = NULL;
+}
+
+static void modem_cmux_dlci_reset_error_recovery(struct modem_cmux_dlci *dlci)
+{
+	k_mutex_lock(&dlci->cmux->transmit_rb_lock, K_FOREVER);
+
+	dlci->send_seq = 0;
+	dlci->send_seq_end = 0;
+	dlci->ack_seq = 0;
+	dlci->receive_seq = 0;
+	dlci->unacked_size = 0;
+	dlci->remote_busy = false;
+	dlci->local_busy = false;
+	dlci->reject_sent = false;
+	dlci->reject_pending = false;
+	dlci->ack_pending = false;
+	dlci->final_pending = false;
+	dlci->retransmit_count = 0;
+
+	k_mutex_unlock(&dlci->cmux->transmit_rb_lock);
+
+	k_work_cancel_delayable(&dlci->retransmit_work.dwork);
+}
+
+/* Remove DLCIs from set being opened, raising event once all DLCIs are done */
+static void modem_cmux_dlcis_opening_remove(struct modem_cmux *cmux, uint64_t mask)
+{
+	bool done;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	done = ((cmux->dlcis_opening & mask) != 0) && ((cmux->dlcis_opening & ~mask) == 0);
+	cmux->dlcis_opening &= ~mask;
+
+	if (done == true) {
+		k_event_post(&cmux->event, MODEM_CMUX_EVENT_DLCIS_OPENED_BIT);
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	if (done == true) {
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DLCIS_OPENED);
+	}
+}
+
+/* Remove DLCIs from set being closed, raising event once all DLCIs are done */
+static void modem_cmux_dlcis_closing_remove(struct modem_cmux *cmux, uint64_t mask)
+{
+	bool done;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	done = ((cmux->dlcis_closing & mask) != 0) && ((cmux->dlcis_closing & ~mask) == 0);
+	cmux->dlcis_closing &= ~mask;
+
+	if (done == true) {
+		k_event_post(&cmux->event, MODEM_CMUX_EVENT_DLCIS_CLOSED_BIT);
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	if (done == true) {
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DLCIS_CLOSED);
+	}
+}
+
+static void modem_cmux_dlci_on_opened(struct modem_cmux_dlci *dlci)
+{
+	dlci->state = MODEM_CMUX_DLCI_STATE_OPEN;
+
+	modem_pipe_notify_opened(&dlci->pipe);
+
+	modem_cmux_dlcis_opening_remove(dlci->cmux, BIT64(dlci->dlci_address));
+}
+
+static void modem_cmux_dlci_on_closed(struct modem_cmux_dlci *dlci)
+{
+	uint64_t mask = BIT64(dlci->dlci_address);
+
+	dlci->state = MODEM_CMUX_DLCI_STATE_CLOSED;
+
+	/* Discard data queued for closed DLCI */
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
+
+	ring_buf_reset(&dlci->transmit_rb);
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	k_work_cancel_delayable(&dlci->retransmit_work.dwork);
+
+	modem_cmux_dlci_free_bufs(dlci);
+
+	modem_pipe_notify_closed(&dlci->pipe);
+
+	k_work_cancel_delayable(&dlci->close_work.dwork);
+
+	/* DLCI which failed to open is done as well */
+	modem_cmux_dlcis_opening_remove(dlci->cmux, mask);
+	modem_cmux_dlcis_closing_remove(dlci->cmux, mask);
+}
+
+static void modem_cmux_on_dlci_frame_ua(struct modem_cmux_dlci *dlci)
+{
+	switch (dlci->state) {
+	case MODEM_CMUX_DLCI_STATE_OPENING:
+		modem_cmux_update_command_rtt(dlci->cmux, dlci->command_sent_ticks,
+					      dlci->command_attempts);
+
+		k_work_cancel_delayable(&dlci->open_work.dwork);
+
+		modem_cmux_dlci_on_opened(dlci);
+
+		break;
+
+	case MODEM_CMUX_DLCI_STATE_CLOSING:
+		modem_cmux_update_command_rtt(dlci->cmux, dlci->command_sent_ticks,
+					      dlci->command_attempts);
+
+		modem_cmux_dlci_on_closed(dlci);
+
+		break;
+
+	default:
+		LOG_DBG("Unexpected UA frame");
+
+		break;
+	}
+}
+
+/* Number of received bytes queued for pipe user */
+static uint32_t modem_cmux_dlci_receive_len(struct modem_cmux_dlci *dlci)
+{
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	if (dlci->receive_buf_pool != NULL) {
+		return dlci->receive_bufs_len;
+	}
+#endif
+
+	return ring_buf_size_get(&dlci->receive_rb);
+}
+
+/*
+ * Pool of network buffers nearly exhausted by buffers queued for pipe user. Small frames
+ * may use up the pool long before the queued data reaches the high watermark.
+ */
+static bool modem_cmux_dlci_receive_bufs_low(struct modem_cmux_dlci *dlci)
+{
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	if (dlci->receive_buf_pool != NULL) {
+		return (dlci->receive_buf_pool->buf_count - dlci->receive_bufs_count) <=
+		       MODEM_CMUX_RECEIVE_BUFS_FREE_MIN;
+	}
+#endif
+
+	return false;
+}
+
+/* Queue received data for pipe user, packed into network buffers if configured */
+static uint32_t modem_cmux_dlci_receive_put(struct modem_cmux_dlci *dlci, const uint8_t *data,
+					    uint16_t data_len)
+{
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	struct net_buf *buf = NULL;
+	uint32_t written = 0;
+	uint16_t len;
+
+	if (dlci->receive_buf_pool != NULL) {
+		/* Fill tailroom of last queued buffer before taking another from pool */
+		if (sys_slist_is_empty(&dlci->receive_bufs) == false) {
+			buf = CONTAINER_OF(sys_slist_peek_tail(&dlci->receive_bufs),
+					   struct net_buf, node);
+		}
+
+		while (written < data_len) {
+			if ((buf == NULL) || (net_buf_tailroom(buf) == 0)) {
+				buf = net_buf_alloc(dlci->receive_buf_pool, K_NO_WAIT);
+
+				if (buf == NULL) {
+					break;
+				}
+
+				sys_slist_append(&dlci->receive_bufs, &buf->node);
+
+				dlci->receive_bufs_count++;
+			}
+
+			len = MIN(data_len - written, net_buf_tailroom(buf));
+
+			net_buf_add_mem(buf, &data[written], len);
+
+			written += len;
+		}
+
+		dlci->receive_bufs_len += written;
+
+		return written;
+	}
+#endif
+
+	return ring_buf_put(&dlci->receive_rb, data, data_len);
+}
+
+/* Copy queued received data to pipe user, releasing network buffers once emptied */
+static uint32_t modem_cmux_dlci_receive_get(struct modem_cmux_dlci *dlci, uint8_t *data,
+					    uint32_t size)
+{
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	struct net_buf *buf;
+	uint32_t copied = 0;
+	uint32_t len;
+
+	if (dlci->receive_buf_pool != NULL) {
+		while ((copied < size) && (sys_slist_is_empty(&dlci->receive_bufs) == false)) {
+			buf = CONTAINER_OF(sys_slist_peek_head(&dlci->receive_bufs), struct net_buf,
+					   node);
+
+			len = MIN(size - copied, buf->len);
+
+			memcpy(&data[copied], net_buf_pull_mem(buf, len), len);
+
+			copied += len;
+
+			if (buf->len == 0) {
+				sys_slist_get(&dlci->receive_bufs);
+
+				net_buf_unref(buf);
+
+				dlci->receive_bufs_count--;
+			}
+		}
+
+		dlci->receive_bufs_len -= copied;
+
+		return copied;
+	}
+#endif
+
+	return ring_buf_get(&dlci->receive_rb, data, size);
+}
+
+/* Ask remote to stop transmitting before receive buffer overruns */
+static void modem_cmux_dlci_check_receive_rb_high_watermark(struct modem_cmux_dlci *dlci)
+{
+	MODEM_CMUX_STATS_MAX(dlci, receive_buf_max, modem_cmux_dlci_receive_len(dlci));
+
+	if ((dlci->receive_rb_stopped == false) &&
+	    ((modem_cmux_dlci_receive_len(dlci) >= dlci->receive_rb_high_watermark) ||
+	     (modem_cmux_dlci_receive_bufs_low(dlci) == true))) {
+		dlci->receive_rb_stopped = modem_cmux_transmit_msc_command(
+			dlci->cmux, dlci, MODEM_CMUX_SIGNAL_FC | dlci->local_signals);
+	}
+}
+
+static void modem_cmux_on_dlci_frame_uih(struct modem_cmux_dlci *dlci)
+{
+	struct modem_cmux *cmux = dlci->cmux;
+	uint32_t written;
+
+	if (dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) {
+		LOG_DBG("Unexpected UIH frame");
+
+		return;
+	}
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	written = modem_cmux_dlci_receive_put(dlci, cmux->frame.data, cmux->frame.data_len);
+
+	MODEM_CMUX_STATS_ADD(dlci, rx_frames, 1);
+	MODEM_CMUX_STATS_ADD(dlci, rx_bytes, written);
+
+	if (written < cmux->frame.data_len) {
+		dlci->receive_rb_dropped += cmux->frame.data_len - written;
+
+		MODEM_CMUX_STATS_ADD(dlci, rx_dropped, cmux->frame.data_len - written);
+
+		LOG_WRN("DLCI %u receive buffer overrun", dlci->dlci_address);
+
+		/* Report overrun to remote once until receive buffer is drained */
+		if (dlci->receive_rb_overrun == false) {
+			dlci->receive_rb_overrun = modem_cmux_transmit_rls_command(
+				cmux, dlci, MODEM_CMUX_LINE_STATUS_OVERRUN);
+		}
+	}
+
+	modem_cmux_dlci_check_receive_rb_high_watermark(dlci);
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	modem_pipe_notify_receive_ready(&dlci->pipe);
+}
+
+/* Release transmitted I frames acknowledged by N(R) received from remote */
+static void modem_cmux_dlci_acknowledge(struct modem_cmux_dlci *dlci, uint8_t nr)
+{
+	uint8_t acked;
+	uint16_t acked_len = 0;
+
+	acked = modem_cmux_seq_diff(dlci->ack_seq, nr);
+
+	if (acked > modem_cmux_seq_diff(dlci->ack_seq, dlci->send_seq_end)) {
+		LOG_WRN("DLCI %u invalid N(R)", dlci->dlci_address);
+
+		return;
+	}
+
+	if (acked == 0) {
+		return;
+	}
+
+	/* Frames pending retransmission may have been received by remote anyway */
+	if (modem_cmux_seq_diff(dlci->ack_seq, dlci->send_seq) < acked) {
+		dlci->send_seq = nr;
+	}
+
+	while (dlci->ack_seq != nr) {
+		acked_len += dlci->unacked_len[dlci->ack_seq];
+		dlci->ack_seq = modem_cmux_seq_next(dlci->ack_seq);
+	}
+
+	dlci->unacked_size -= acked_len;
+	dlci->retransmit_count = 0;
+
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
+
+	ring_buf_get(&dlci->transmit_rb, NULL, acked_len);
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	if (dlci->ack_seq == dlci->send_seq_end) {
+		k_work_cancel_delayable(&dlci->retransmit_work.dwork);
+	} else {
+		k_work_reschedule_for_queue(dlci->cmux->work_q, &dlci->retransmit_work.dwork,
+				  modem_cmux_t1_timeout(dlci->cmux));
+	}
+}
+
+static void modem_cmux_on_dlci_frame_i(struct modem_cmux_dlci *dlci)
+{
+	struct modem_cmux *cmux = dlci->cmux;
+	uint8_t ns = (cmux->frame.type >> 1) & MODEM_CMUX_SEQ_MASK;
+	uint8_t nr = (cmux->frame.type >> 5) & MODEM_CMUX_SEQ_MASK;
+	bool accepted = false;
+
+	if ((dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) || (dlci->error_recovery == false)) {
+		LOG_DBG("Unexpected I frame");
+
+		return;
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	modem_cmux_dlci_acknowledge(dlci, nr);
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	/* Frame is only accepted in sequence and in full, otherwise remote retransmits it */
+	if (ns == dlci->receive_seq) {
+		k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+		if (ring_buf_space_get(&dlci->receive_rb) >= cmux->frame.data_len) {
+			ring_buf_put(&dlci->receive_rb, cmux->frame.data, cmux->frame.data_len);
+
+			modem_cmux_dlci_check_receive_rb_high_watermark(dlci);
+
+			MODEM_CMUX_STATS_ADD(dlci, rx_frames, 1);
+			MODEM_CMUX_STATS_ADD(dlci, rx_bytes, cmux->frame.data_len);
+
+			accepted = true;
+		}
+
+		k_mutex_unlock(&dlci->receive_rb_lock);
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if (accepted == true) {
+		dlci->receive_seq = modem_cmux_seq_next(dlci->receive_seq);
+		dlci->reject_sent = false;
+		dlci->local_busy = false;
+	} else if (ns == dlci->receive_seq) {
+		LOG_WRN("DLCI %u receive buffer full", dlci->dlci_address);
+
+		dlci->local_busy = true;
+	} else if (dlci->reject_sent == false) {
+		LOG_DBG("DLCI %u N(S) %u out of sequence", dlci->dlci_address, ns);
+
+		dlci->reject_sent = true;
+		dlci->reject_pending = true;
+	}
+
+	dlci->ack_pending = true;
+	dlci->final_pending |= cmux->frame.pf;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+
+	if (accepted == true) {
+		modem_pipe_notify_receive_ready(&dlci->pipe);
+	}
+}
+
+static void modem_cmux_on_dlci_frame_supervisory(struct modem_cmux_dlci *dlci)
+{
+	struct modem_cmux *cmux = dlci->cmux;
+	uint8_t nr = (cmux->frame.type >> 5) & MODEM_CMUX_SEQ_MASK;
+
+	if ((dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) || (dlci->error_recovery == false)) {
+		LOG_DBG("Unexpected supervisory frame");
+
+		return;
+	}
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	modem_cmux_dlci_acknowledge(dlci, nr);
+
+	switch (cmux->frame.type & 0x0F) {
+	case MODEM_CMUX_FRAME_TYPE_RR:
+		dlci->remote_busy = false;
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_RNR:
+		dlci->remote_busy = true;
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_REJ:
+		dlci->remote_busy = false;
+
+		/* Retransmit all unacknowledged frames */
+		dlci->send_seq = dlci->ack_seq;
+
+		break;
+
+	default:
+		break;
+	}
+
+	/* Answer poll from remote */
+	if ((cmux->frame.cr == true) && (cmux->frame.pf == true)) {
+		dlci->ack_pending = true;
+		dlci->final_pending = true;
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+}
+
+/* DLCI opened by initiator, regardless of whether DLCI pipe is opened yet */
+static void modem_cmux_on_dlci_frame_sabm(struct modem_cmux_dlci *dlci)
+{
+	struct modem_cmux *cmux = dlci->cmux;
+
+	if (cmux->role != MODEM_CMUX_ROLE_RESPONDER) {
+		modem_cmux_log_unknown_frame(cmux);
+
+		return;
+	}
+
+	if (dlci->state == MODEM_CMUX_DLCI_STATE_OPEN) {
+		/* UA frame lost, answer retransmitted SABM */
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+		return;
+	}
+
+	if ((cmux->state != MODEM_CMUX_STATE_CONNECTED) ||
+	    (modem_cmux_dlci_alloc_bufs(dlci) < 0)) {
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_DM);
+
+		return;
+	}
+
+	dlci->remote_signals = 0;
+	dlci->remote_line_status = 0;
+
+	modem_cmux_dlci_reset_error_recovery(dlci);
+
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+
+	dlci->receive_rb_stopped = false;
+	dlci->receive_rb_overrun = false;
+
+	k_mutex_unlock(&dlci->receive_rb_lock);
+
+	modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+	modem_cmux_dlci_on_opened(dlci);
+}
+
+static void modem_cmux_on_dlci_frame_disc(struct modem_cmux_dlci *dlci)
+{
+	struct modem_cmux *cmux = dlci->cmux;
+
+	if (dlci->state == MODEM_CMUX_DLCI_STATE_CLOSED) {
+		modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_DM);
+
+		return;
+	}
+
+	modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_UA);
+
+	k_work_cancel_delayable(&dlci->open_work.dwork);
+
+	modem_cmux_dlci_on_closed(dlci);
+}
+
+static void modem_cmux_on_dlci_frame(struct modem_cmux *cmux)
+{
+	struct modem_cmux_dlci *dlci;
+
+	dlci = modem_cmux_find_dlci(cmux, cmux->frame.dlci_address);
+
+	if (dlci == NULL) {
+		LOG_WRN("Could not find DLCI: %u", cmux->frame.dlci_address);
+
+		MODEM_CMUX_STATS_ADD(cmux, unknown_dlci_frames, 1);
+
+		if ((cmux->frame.type == MODEM_CMUX_FRAME_TYPE_SABM) ||
+		    (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_DISC)) {
+			modem_cmux_transmit_response(cmux, MODEM_CMUX_FRAME_TYPE_DM);
+		}
+
+		return;
+	}
+
+	modem_cmux_power_save_restart(cmux);
+
+	switch (cmux->frame.type) {
+	case MODEM_CMUX_FRAME_TYPE_UA:
+		modem_cmux_on_dlci_frame_ua(dlci);
+
+		break;
+
+	/* UI frames only differ by FCS, which has been validated */
+	case MODEM_CMUX_FRAME_TYPE_UI:
+	case MODEM_CMUX_FRAME_TYPE_UIH:
+		modem_cmux_on_dlci_frame_uih(dlci);
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_SABM:
+		modem_cmux_on_dlci_frame_sabm(dlci);
+
+		break;
+
+	case MODEM_CMUX_FRAME_TYPE_DISC:
+		modem_cmux_on_dlci_frame_disc(dlci);
+
+		break;
+
+	default:
+		/* I and supervisory frames carry sequence numbers in control field */
+		if ((cmux->frame.type & 0x01) == 0) {
+			modem_cmux_on_dlci_frame_i(dlci);
+		} else if ((cmux->frame.type & 0x03) == 0x01) {
+			modem_cmux_on_dlci_frame_supervisory(dlci);
+		} else {
+			modem_cmux_log_unknown_frame(cmux);
+		}
+
+		break;
+	}
+}
+
+static void modem_cmux_on_frame(struct modem_cmux *cmux)
+{
+	MODEM_CMUX_STATS_ADD(cmux, rx_frames, 1);
+	MODEM_CMUX_STATS_MAX(cmux, receive_buf_max, cmux->receive_buf_len);
+
+	if (cmux->frame.dlci_address == 0) {
+		modem_cmux_on_control_frame(cmux);
+
+		return;
+	}
+
+	modem_cmux_on_dlci_frame(cmux);
+}
+
+static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t byte)
+{
+	uint8_t fcs;
+	static const uint8_t resync[3] = {0xF9, 0xF9, 0xF9};
+
+	switch (cmux->receive_state) {
+	case MODEM_CMUX_RECEIVE_STATE_SOF:
+		if (byte == 0xF9) {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_ADDRESS;
+
+			break;
+		}
+
+		/* Send resync flags, at most once per resync interval */
+		if (k_uptime_ticks() >= cmux->resync_allowed_ticks) {
+			modem_pipe_transmit(cmux->pipe, resync, sizeof(resync));
+
+			cmux->resync_allowed_ticks = k_uptime_ticks() +
+				k_ms_to_ticks_ceil32(MODEM_CMUX_RESYNC_INTERVAL_MS);
+		}
+
+		MODEM_CMUX_STATS_ADD(cmux, resyncs, 1);
+
+		/* Await resync flags */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_RESYNC_0:
+		if (byte == 0xF9) {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_1;
+		}
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_RESYNC_1:
+		if (byte == 0xF9) {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_2;
+		} else {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
+		}
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_RESYNC_2:
+		if (byte == 0xF9) {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_3;
+		} else {
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
+		}
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_RESYNC_3:
+		if (byte == 0xF9) {
+			break;
+		}
+
+	case MODEM_CMUX_RECEIVE_STATE_ADDRESS:
+		/* Initialize */
+		cmux->receive_buf_len = 0;
+		cmux->frame_header_len = 0;
+
+		/* Store header for FCS */
+		cmux->frame_header[cmux->frame_header_len] = byte;
+		cmux->frame_header_len++;
+
+		/* Get CR */
+		cmux->frame.cr = (byte & 0x02) ? true : false;
+
+		/* Get DLCI address */
+		cmux->frame.dlci_address = (byte >> 2) & 0x3F;
+
+		/* Await control */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_CONTROL;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_CONTROL:
+		/* Store header for FCS */
+		cmux->frame_header[cmux->frame_header_len] = byte;
+		cmux->frame_header_len++;
+
+		/* Get PF */
+		cmux->frame.pf = (byte & MODEM_CMUX_PF) ? true : false;
+
+		/* Get frame type */
+		cmux->frame.type = byte & (~MODEM_CMUX_PF);
+
+		/* Await data length */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_LENGTH;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_LENGTH:
+		/* Store header for FCS */
+		cmux->frame_header[cmux->frame_header_len] = byte;
+		cmux->frame_header_len++;
+
+		/* Get first 7 bits of data length */
+		cmux->frame.data_len = (byte >> 1);
+
+		/* Check if length field continues */
+		if ((byte & MODEM_CMUX_EA) == 0) {
+			/* Await continued length field */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_LENGTH_CONT;
+
+			break;
+		}
+
+		/* Check if no data field */
+		if (cmux->frame.data_len == 0) {
+			/* Await FCS */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+
+			break;
+		}
+
+		/* Await data */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_LENGTH_CONT:
+		/* Store header for FCS */
+		cmux->frame_header[cmux->frame_header_len] = byte;
+		cmux->frame_header_len++;
+
+		/* Get last 8 bits of data length */
+		cmux->frame.data_len |= ((uint16_t)byte) << 7;
+
+		/* Await data */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_DATA:
+		/* Copy byte to data */
+		cmux->receive_buf[cmux->receive_buf_len] = byte;
+		cmux->receive_buf_len++;
+
+		/* Check if datalen reached */
+		if (cmux->frame.data_len == cmux->receive_buf_len) {
+			/* Await FCS */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+
+			break;
+		}
+
+		/* Check if receive buffer overrun */
+		if (cmux->receive_buf_len == cmux->receive_buf_size) {
+			LOG_DBG("Receive buf overrun");
+
+			MODEM_CMUX_STATS_ADD(cmux, dropped_frames, 1);
+
+			/* Drop frame without dispatching it, as its data length exceeds buffer */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+
+			break;
+		}
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_FCS:
+		/* Compute FCS */
+		fcs = modem_cmux_fcs_update(MODEM_CMUX_FCS_INIT_VALUE, cmux->frame_header,
+					    cmux->frame_header_len);
+
+		/* Frame data is only referenced by frame once frame is complete */
+		if (cmux->frame.type != MODEM_CMUX_FRAME_TYPE_UIH) {
+			fcs = modem_cmux_fcs_update(fcs, cmux->receive_buf, cmux->frame.data_len);
+		}
+
+		fcs = 0xFF - fcs;
+
+		/* Validate FCS */
+		if (fcs != byte) {
+			LOG_WRN("Frame FCS error");
+
+			MODEM_CMUX_STATS_ADD(cmux, fcs_errors, 1);
+
+			/* Drop frame */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DROP;
+
+			break;
+		}
+
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_EOF;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_DROP:
+		LOG_WRN("Dropped frame");
+
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+
+		break;
+
+	case MODEM_CMUX_RECEIVE_STATE_EOF:
+		/* Validate byte is EOF */
+		if (byte != 0xF9) {
+			/* Unexpected byte */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+
+			break;
+		}
+
+		LOG_DBG("Received frame");
+
+		/* Process frame */
+		cmux->frame.data = cmux->receive_buf;
+		modem_cmux_on_frame(cmux);
+
+		/* Await start of next frame */
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+/* Bytes preceding the first resync flag are skipped in bulk with memchr() */
+static void modem_cmux_process_received_bytes(struct modem_cmux *cmux, const uint8_t *bytes,
+					      uint16_t bytes_len)
+{
+	const uint8_t *end = &bytes[bytes_len];
+
+	while (bytes < end) {
+		if (cmux->receive_state == MODEM_CMUX_RECEIVE_STATE_RESYNC_0) {
+			bytes = memchr(bytes, 0xF9, end - bytes);
+
+			if (bytes == NULL) {
+				return;
+			}
+		}
+
+		modem_cmux_process_received_byte(cmux, *bytes);
+		bytes++;
+	}
+}
+
+static void modem_cmux_advanced_frame_reset(struct modem_cmux *cmux)
+{
+	cmux->receive_buf_len = 0;
+	cmux->frame_header_len = 0;
+	cmux->receive_escape = false;
+	cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
+}
+
+/* Store unescaped octets of frame, address and control in header, data and FCS in buffer */
+static bool modem_cmux_advanced_frame_store(struct modem_cmux *cmux, const uint8_t *data,
+					    uint16_t data_len)
+{
+	while ((cmux->frame_header_len < 2) && (data_len > 0)) {
+		cmux->frame_header[cmux->frame_header_len] = *data;
+		cmux->frame_header_len++;
+		data++;
+		data_len--;
+	}
+
+	if ((cmux->receive_buf_size - cmux->receive_buf_len) < data_len) {
+		LOG_DBG("Receive buf overrun");
+
+		MODEM_CMUX_STATS_ADD(cmux, dropped_frames, 1);
+
+		return false;
+	}
+
+	memcpy(&cmux->receive_buf[cmux->receive_buf_len], data, data_len);
+	cmux->receive_buf_len += data_len;
+
+	return true;
+}
+
+static void modem_cmux_on_advanced_frame_end(struct modem_cmux *cmux)
+{
+	uint8_t fcs;
+
+	/* Flag shared by consecutive frames or repeated as fill */
+	if ((cmux->frame_header_len == 0) && (cmux->receive_escape == false)) {
+		return;
+	}
+
+	/* Address, control and FCS are required */
+	if ((cmux->frame_header_len < 2) || (cmux->receive_buf_len < 1) ||
+	    (cmux->receive_escape == true)) {
+		LOG_WRN("Dropped frame");
+
+		MODEM_CMUX_STATS_ADD(cmux, dropped_frames, 1);
+
+		return;
+	}
+
+	cmux->frame.cr = (cmux->frame_header[0] & MODEM_CMUX_CR) ? true : false;
+	cmux->frame.dlci_address = (cmux->frame_header[0] >> 2) & 0x3F;
+	cmux->frame.pf = (cmux->frame_header[1] & MODEM_CMUX_PF) ? true : false;
+	cmux->frame.type = cmux->frame_header[1] & (~MODEM_CMUX_PF);
+	cmux->frame.data = cmux->receive_buf;
+	cmux->frame.data_len = cmux->receive_buf_len - 1;
+
+	/* Compute FCS */
+	fcs = modem_cmux_fcs_update(MODEM_CMUX_FCS_INIT_VALUE, cmux->frame_header,
+				    cmux->frame_header_len);
+
+	if (cmux->frame.type != MODEM_CMUX_FRAME_TYPE_UIH) {
+		fcs = modem_cmux_fcs_update(fcs, cmux->frame.data, cmux->frame.data_len);
+	}
+
+	/* Validate FCS */
+	if ((0xFF - fcs) != cmux->receive_buf[cmux->frame.data_len]) {
+		LOG_WRN("Frame FCS error");
+
+		MODEM_CMUX_STATS_ADD(cmux, fcs_errors, 1);
+
+		return;
+	}
+
+	LOG_DBG("Received frame");
+
+	modem_cmux_on_frame(cmux);
+}
+
+/*
+ * Frames are delimited by flags, so a corrupted octet only costs the frame containing it.
+ * Flags are located with memchr() while hunting, and octets between escapes are copied
+ * to the frame in runs.
+ */
+static void modem_cmux_process_received_bytes_advanced(struct modem_cmux *cmux,
+						       const uint8_t *bytes, uint16_t bytes_len)
+{
+	const uint8_t *end = &bytes[bytes_len];
+	const uint8_t *run;
+	uint8_t byte;
+
+	while (bytes < end) {
+		/* Hunt for flag opening next frame */
+		if (cmux->receive_state != MODEM_CMUX_RECEIVE_STATE_DATA) {
+			bytes = memchr(bytes, MODEM_CMUX_ADVANCED_FLAG, end - bytes);
+
+			if (bytes == NULL) {
+				return;
+			}
+
+			modem_cmux_advanced_frame_reset(cmux);
+			bytes++;
+
+			continue;
+		}
+
+		/* Octet following control escape */
+		if ((cmux->receive_escape == true) && (*bytes != MODEM_CMUX_ADVANCED_FLAG)) {
+			cmux->receive_escape = false;
+
+			byte = *bytes ^ MODEM_CMUX_ADVANCED_ESCAPE_MASK;
+			bytes++;
+
+			if (modem_cmux_advanced_frame_store(cmux, &byte, 1) == false) {
+				cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DROP;
+			}
+
+			continue;
+		}
+
+		/* Find run of octets up to next flag or control escape */
+		for (run = bytes; run < end; run++) {
+			if ((*run == MODEM_CMUX_ADVANCED_FLAG) ||
+			    (*run == MODEM_CMUX_ADVANCED_ESCAPE)) {
+				break;
+			}
+		}
+
+		if (modem_cmux_advanced_frame_store(cmux, bytes, run - bytes) == false) {
+			/* Drop frame, its closing flag opens the next frame */
+			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DROP;
+			bytes = run;
+
+			continue;
+		}
+
+		bytes = run;
+
+		if (bytes == end) {
+			break;
+		}
+
+		if (*bytes == MODEM_CMUX_ADVANCED_ESCAPE) {
+			cmux->receive_escape = true;
+		} else {
+			modem_cmux_on_advanced_frame_end(cmux);
+
+			/* Closing flag also opens the next frame */
+			modem_cmux_advanced_frame_reset(cmux);
+		}
+
+		bytes++;
+	}
+}
+
+static void modem_cmux_power_save_exit(struct modem_cmux *cmux)
+{
+	bool entered;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	/* Answer wake-up procedure initiated by remote */
+	if (cmux->waking == false) {
+		modem_cmux_transmit_wake_up_flags(cmux);
+	}
+
+	cmux->power_saving = false;
+	cmux->waking = false;
+	cmux->receive_skip_flags = true;
+
+	entered = modem_cmux_power_save_entered_take(cmux);
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_cancel_delayable(&cmux->wake_up_work.dwork);
+
+	/* Keep events in order if power save was exited before entering was raised */
+	if (entered == true) {
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_POWER_SAVE_ENTERED);
+	}
+
+	LOG_DBG("Power save exited");
+
+	modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_POWER_SAVE_EXITED);
+
+	modem_cmux_power_save_restart(cmux);
+
+	/* Transmit data queued while power saving */
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+}
+
+/*
+ * While power saving, received data is discarded until a flag is received, which
+ * completes the wake-up procedure. Flags are then skipped until the first frame starts.
+ * Returns number of bytes consumed.
+ */
+static uint16_t modem_cmux_receive_wake_up_flags(struct modem_cmux *cmux, const uint8_t *buf,
+						 uint16_t buf_len)
+{
+	uint8_t flag = modem_cmux_flag(cmux);
+	const uint8_t *pos;
+	uint16_t consumed = 0;
+
+	if (cmux->power_saving == true) {
+		pos = memchr(buf, flag, buf_len);
+
+		if (pos == NULL) {
+			return buf_len;
+		}
+
+		modem_cmux_power_save_exit(cmux);
+
+		consumed = pos - buf;
+	}
+
+	while ((consumed < buf_len) && (buf[consumed] == flag)) {
+		consumed++;
+	}
+
+	if (consumed == buf_len) {
+		return consumed;
+	}
+
+	cmux->receive_skip_flags = false;
+
+	/* The last flag skipped opens the first frame */
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		modem_cmux_advanced_frame_reset(cmux);
+	} else {
+		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_ADDRESS;
+	}
+
+	return consumed;
+}
+
+static void modem_cmux_receive_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_process = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_process->cmux;
+	uint8_t buf[16];
+	uint16_t received = 0;
+	uint16_t consumed;
+	int ret;
+
+	/* Receive data from pipe until it is empty or the receive budget is spent */
+	while (received < cmux->receive_budget) {
+		ret = modem_pipe_receive(cmux->pipe, buf,
+					 MIN(sizeof(buf), cmux->receive_budget - received));
+
+		if (ret < 1) {
+			return;
+		}
+
+		received += (uint16_t)ret;
+		consumed = 0;
+
+		if ((cmux->power_saving == true) || (cmux->receive_skip_flags == true)) {
+			consumed = modem_cmux_receive_wake_up_flags(cmux, buf, (uint16_t)ret);
+		}
+
+		/* Process received data */
+		if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+			modem_cmux_process_received_bytes_advanced(cmux, &buf[consumed],
+								   (uint16_t)ret - consumed);
+		} else {
+			modem_cmux_process_received_bytes(cmux, &buf[consumed],
+							  (uint16_t)ret - consumed);
+		}
+	}
+
+	/* Yield to work of other instances, then continue receiving */
+	k_work_schedule_for_queue(cmux->work_q, &cmux->receive_work.dwork, K_NO_WAIT);
+}
+
+/* Called with transmit buffer lock held, event is raised once lock is released */
+static void modem_cmux_power_save_enter(struct modem_cmux *cmux)
+{
+	cmux->power_save_requested = false;
+	cmux->power_saving = true;
+	cmux->power_save_entered = true;
+
+	k_work_cancel_delayable(&cmux->power_save_work.dwork);
+
+	LOG_DBG("Power save entered");
+}
+
+static bool modem_cmux_transmit_buffers_empty(struct modem_cmux *cmux)
+{
+	return (ring_buf_is_empty(&cmux->transmit_rb) == true) && (cmux->transmit_stage_len == 0);
+}
+
+/* Transmit contiguous part of transmit buffer */
+static int modem_cmux_transmit_reserved(struct modem_cmux *cmux)
+{
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	int ret;
+
+	reserved_size = ring_buf_get_claim(&cmux->transmit_rb, &reserved, UINT32_MAX);
+
+	ret = modem_pipe_transmit(cmux->pipe, reserved, reserved_size);
+
+	ring_buf_get_finish(&cmux->transmit_rb, (ret < 1) ? 0 : ret);
+
+	return ret;
+}
+
+/* Get size of frame at start of frames, 0 if it does not end within size bytes */
+static uint16_t modem_cmux_staged_frame_size(struct modem_cmux *cmux, const uint8_t *frames,
+					     uint16_t size)
+{
+	const uint8_t *eof;
+	uint16_t frame_size;
+
+	/* Flags within frame are escaped in advanced option, so frame ends at next flag */
+	if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+		eof = (size < 2) ? NULL : memchr(&frames[1], MODEM_CMUX_ADVANCED_FLAG, size - 1);
+
+		return (eof == NULL) ? 0 : (eof - frames) + 1;
+	}
+
+	if (size < 5) {
+		return 0;
+	}
+
+	/* SOF, address, control, length, FCS and EOF, length is two bytes unless EA bit set */
+	if ((frames[3] & 0x01) == 0x01) {
+		frame_size = (frames[3] >> 1) + 6;
+	} else {
+		frame_size = ((frames[3] >> 1) | ((frames[4] >> 1) << 7)) + 7;
+	}
+
+	return (frame_size <= size) ? frame_size : 0;
+}
+
+/*
+ * Refill stage buffer with whole frames from transmit buffer, which frames are queued whole
+ * in. A frame larger than the stage buffer is staged in parts, transmit_stage_split holding
+ * the number of bytes of it left, or being set until its EOF flag in advanced option.
+ */
+static void modem_cmux_transmit_stage_refill(struct modem_cmux *cmux)
+{
+	uint8_t *stage = &cmux->transmit_stage_buf[cmux->transmit_stage_len];
+	const uint8_t *eof;
+	uint16_t frame_size;
+	uint16_t offset = 0;
+	uint16_t size;
+
+	size = ring_buf_peek(&cmux->transmit_rb, stage,
+			     cmux->transmit_stage_buf_size - cmux->transmit_stage_len);
+
+	if ((cmux->transmit_stage_split > 0) && (cmux->option == MODEM_CMUX_OPTION_ADVANCED)) {
+		eof = memchr(stage, MODEM_CMUX_ADVANCED_FLAG, size);
+		offset = (eof == NULL) ? size : (eof - stage) + 1;
+		cmux->transmit_stage_split = (eof == NULL) ? 1 : 0;
+	} else if (cmux->transmit_stage_split > 0) {
+		offset = MIN(cmux->transmit_stage_split, size);
+		cmux->transmit_stage_split -= offset;
+	}
+
+	while (cmux->transmit_stage_split == 0) {
+		frame_size = modem_cmux_staged_frame_size(cmux, &stage[offset], size - offset);
+
+		if (frame_size == 0) {
+			break;
+		}
+
+		offset += frame_size;
+	}
+
+	/* Frame larger than stage buffer, size of basic option frame is known from its header */
+	if ((offset == 0) && (size == cmux->transmit_stage_buf_size)) {
+		if (cmux->option == MODEM_CMUX_OPTION_ADVANCED) {
+			cmux->transmit_stage_split = 1;
+		} else {
+			frame_size = modem_cmux_staged_frame_size(cmux, stage, UINT16_MAX);
+			cmux->transmit_stage_split = frame_size - size;
+		}
+
+		offset = size;
+	}
+
+	ring_buf_get(&cmux->transmit_rb, NULL, offset);
+
+	cmux->transmit_stage_len += offset;
+}
+
+/*
+ * Refill stage buffer from transmit buffer across its wrap, and transmit it in one burst.
+ * Bytes not accepted by the bus pipe are moved to the start of the stage buffer, to be
+ * transmitted ahead of the next frames.
+ */
+static int modem_cmux_transmit_staged(struct modem_cmux *cmux)
+{
+	int ret;
+
+	modem_cmux_transmit_stage_refill(cmux);
+
+	ret = modem_pipe_transmit(cmux->pipe, cmux->transmit_stage_buf, cmux->transmit_stage_len);
+
+	if (ret < 1) {
+		return ret;
+	}
+
+	cmux->transmit_stage_len -= ret;
+
+	memmove(cmux->transmit_stage_buf, &cmux->transmit_stage_buf[ret],
+		cmux->transmit_stage_len);
+
+	return ret;
+}
+
+/* Transmit frames to bus, called with transmit buffer lock held */
+static void modem_cmux_transmit(struct modem_cmux *cmux)
+{
+	int ret;
+
+	if ((cmux->power_save_requested == true) &&
+	    (modem_cmux_transmit_buffers_empty(cmux) == true)) {
+		modem_cmux_power_save_enter(cmux);
+	}
+
+	/* Wake remote before transmitting data queued while power saving */
+	if (cmux->power_saving == true) {
+		if ((cmux->waking == false) &&
+		    ((modem_cmux_transmit_buffers_empty(cmux) == false) ||
+		     (modem_cmux_transmit_data_pending(cmux) == true))) {
+			LOG_DBG("Waking remote");
+
+			cmux->waking = true;
+			cmux->wake_up_attempts = 0;
+
+			k_work_schedule_for_queue(cmux->work_q, &cmux->wake_up_work.dwork,
+						  K_NO_WAIT);
+		}
+
+		if (cmux->waking == false) {
+			modem_cmux_transmit_schedule_coalesced(cmux);
+		}
+
+		return;
+	}
+
+	/* Frame data from DLCI transmit queues */
+	modem_cmux_transmit_data_frames(cmux);
+
+	modem_cmux_transmit_supervisory_frames(cmux);
+
+	if (modem_cmux_transmit_buffers_empty(cmux) == true) {
+		modem_cmux_transmit_schedule_coalesced(cmux);
+
+		return;
+	}
+
+	if (cmux->transmit_stage_buf != NULL) {
+		ret = modem_cmux_transmit_staged(cmux);
+	} else {
+		ret = modem_cmux_transmit_reserved(cmux);
+	}
+
+	if (ret < 1) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+
+		return;
+	}
+
+	/* Resubmit transmit work if data remains or power saving shall be entered */
+	if ((modem_cmux_transmit_buffers_empty(cmux) == false) ||
+	    (modem_cmux_transmit_data_pending(cmux) == true) ||
+	    (cmux->power_save_requested == true)) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+	} else {
+		modem_cmux_transmit_schedule_coalesced(cmux);
+	}
+}
+
+static void modem_cmux_transmit_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+	bool entered;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	modem_cmux_transmit(cmux);
+
+	entered = modem_cmux_power_save_entered_take(cmux);
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	if (entered == true) {
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_POWER_SAVE_ENTERED);
+	}
+}
+
+/* Transmit from writer's context if transmit work is idle, work serves contention */
+static void modem_cmux_transmit_request(struct modem_cmux *cmux)
+{
+	bool entered;
+
+	if ((cmux->direct_transmit == false) ||
+	    (k_work_delayable_busy_get(&cmux->transmit_work.dwork) != 0) ||
+	    (k_mutex_lock(&cmux->transmit_rb_lock, K_NO_WAIT) < 0)) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+
+		return;
+	}
+
+	modem_cmux_transmit(cmux);
+
+	entered = cmux->power_save_entered;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	/* Raise power save entered event from transmit work rather than writer's context */
+	if (entered == true) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+	}
+}
+
+static void modem_cmux_coalesce_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
+}
+
+/* Request power saving when no data has been transmitted or received on any DLCI */
+static void modem_cmux_power_save_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+
+	if ((cmux->state != MODEM_CMUX_STATE_CONNECTED) || (cmux->power_saving == true) ||
+	    (cmux->power_save_requested == true)) {
+		return;
+	}
+
+	LOG_DBG("Requesting power save");
+
+	if (modem_cmux_transmit_psc_command(cmux) == false) {
+		modem_cmux_power_save_restart(cmux);
+	}
+}
+
+/* Transmit flags until remote answers with flags, or T3 expires */
+static void modem_cmux_wake_up_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if (cmux->waking == false) {
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		return;
+	}
+
+	if (cmux->wake_up_attempts == MODEM_CMUX_WAKE_UP_ATTEMPTS_MAX) {
+		LOG_WRN("Remote not responding to wake-up procedure");
+
+		cmux->waking = false;
+
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		return;
+	}
+
+	cmux->wake_up_attempts++;
+
+	modem_cmux_transmit_wake_up_flags(cmux);
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->wake_up_work.dwork,
+				  K_MSEC(MODEM_CMUX_WAKE_UP_INTERVAL_MS));
+}
+
+/*
+ * Transmit TEST command every keepalive interval. A command not answered within T2,
+ * or the keepalive interval if shorter, is missed.
+ */
+static void modem_cmux_keepalive_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+	uint8_t value[MODEM_CMUX_KEEPALIVE_DATA_SIZE];
+	uint32_t timeout_ms;
+
+	if (cmux->state != MODEM_CMUX_STATE_CONNECTED) {
+		return;
+	}
+
+	if (cmux->keepalive_pending == true) {
+		cmux->keepalive_pending = false;
+		cmux->keepalive_missed++;
+		cmux->keepalive_stats.missed++;
+
+		LOG_WRN("TEST command not answered");
+
+		if (cmux->keepalive_missed == MODEM_CMUX_KEEPALIVE_MISSED_MAX) {
+			modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_UNRESPONSIVE);
+		}
+
+		k_work_schedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork,
+					  K_MSEC(cmux->keepalive_interval_ms));
+
+		return;
+	}
+
+	/* Keepalive must not wake remote */
+	if (cmux->power_saving == true) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork,
+					  K_MSEC(cmux->keepalive_interval_ms));
+
+		return;
+	}
+
+	cmux->keepalive_seq++;
+
+	modem_cmux_encode_keepalive_value(cmux->keepalive_seq, value);
+
+	if (modem_cmux_transmit_test_command(cmux, value, sizeof(value)) == false) {
+		k_work_schedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork,
+					  K_MSEC(cmux->keepalive_interval_ms));
+
+		return;
+	}
+
+	cmux->keepalive_sent_ticks = k_uptime_ticks();
+	cmux->keepalive_pending = true;
+	cmux->keepalive_stats.sent++;
+
+	timeout_ms = MIN(cmux->keepalive_interval_ms, modem_cmux_t2_timeout_ms(cmux));
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->keepalive_work.dwork, K_MSEC(timeout_ms));
+}
+
+static void modem_cmux_connect_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+
+	if (cmux->state != MODEM_CMUX_STATE_CONNECTING) {
+		cmux->command_attempts = 0;
+	}
+
+	cmux->state = MODEM_CMUX_STATE_CONNECTING;
+
+	modem_cmux_power_save_reset(cmux);
+
+	k_work_cancel_delayable(&cmux->keepalive_work.dwork);
+
+	/* Responder listens for SABM frame from initiator */
+	if (cmux->role == MODEM_CMUX_ROLE_RESPONDER) {
+		return;
+	}
+
+	if (modem_cmux_command_attempt(cmux, &cmux->command_attempts) == false) {
+		LOG_WRN("SABM not answered after %u retransmissions", cmux->n2);
+
+		cmux->state = MODEM_CMUX_STATE_DISCONNECTED;
+
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_CONNECT_FAILED);
+
+		return;
+	}
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = true,
+		.type = MODEM_CMUX_FRAME_TYPE_SABM,
+		.data = NULL,
+		.data_len = 0,
+	};
+
+	modem_cmux_transmit_cmd_frame(cmux, &frame);
+
+	cmux->command_sent_ticks = k_uptime_ticks();
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->connect_work.dwork,
+				  modem_cmux_t1_timeout(cmux));
+}
+
+static void modem_cmux_disconnect_handler(struct k_work *item)
+{
+	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
+	struct modem_cmux *cmux = cmux_work->cmux;
+	struct modem_cmux_command *command;
+	uint8_t data[2];
+
+	if (cmux->state != MODEM_CMUX_STATE_DISCONNECTING) {
+		cmux->command_attempts = 0;
+	}
+
+	cmux->state = MODEM_CMUX_STATE_DISCONNECTING;
+
+	/* Remote is considered closed down if CLD is not answered */
+	if (modem_cmux_command_attempt(cmux, &cmux->command_attempts) == false) {
+		LOG_WRN("CLD not answered after %u retransmissions", cmux->n2);
+
+		modem_cmux_on_disconnected(cmux);
+
+		return;
+	}
+
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = MODEM_CMUX_COMMAND_CLD;
+	command->length.ea = 1;
+	command->length.value = 0;
+
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
+
+	/* Transmit close down command */
+	modem_cmux_transmit_cmd_frame(cmux, &frame);
+
+	cmux->command_sent_ticks = k_uptime_ticks();
 
-	return NULL;
+	k_work_schedule_for_queue(cmux->work_q, &cmux->disconnect_work.dwork,
+				  modem_cmux_t1_timeout(cmux));
 }
 
-static void modem_cmux_on_dlci_frame_ua(struct modem_cmux_dlci *dlci)
+static int modem_cmux_dlci_pipe_api_open(void *data)
 {
-	switch (dlci->state) {
-	case MODEM_CMUX_DLCI_STATE_OPENING:
-		dlci->state = MODEM_CMUX_DLCI_STATE_OPEN;
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	int ret;
 
-		modem_pipe_notify_opened(&dlci->pipe);
+	if (k_work_delayable_is_pending(&dlci->open_work.dwork) == true) {
+		return -EBUSY;
+	}
 
-		k_work_cancel_delayable(&dlci->open_work.dwork);
+	ret = modem_cmux_dlci_alloc_bufs(dlci);
 
-		break;
+	if (ret < 0) {
+		return ret;
+	}
 
-	case MODEM_CMUX_DLCI_STATE_CLOSING:
-		dlci->state = MODEM_CMUX_DLCI_STATE_CLOSED;
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->open_work.dwork, K_NO_WAIT);
 
-		modem_pipe_notify_closed(&dlci->pipe);
+	return 0;
+}
+
+static int modem_cmux_dlci_pipe_api_transmit(void *data, const uint8_t *buf, uint32_t size)
+{
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	struct modem_cmux *cmux = dlci->cmux;
+	uint32_t ret;
 
-		k_work_cancel_delayable(&dlci->close_work.dwork);
+	if ((dlci->atomic_transmit == true) && (size > dlci->transmit_buf_size)) {
+		return -EMSGSIZE;
+	}
 
-		break;
+	if (cmux->flow_control_on == false) {
+		return 0;
+	}
 
-	default:
-		LOG_DBG("Unexpected UA frame");
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
 
-		break;
+	/* Coalescing window starts when data is written to an idle DLCI */
+	if (ring_buf_is_empty(&dlci->transmit_rb) == true) {
+		dlci->coalesce_start_ticks = k_uptime_ticks();
+		dlci->coalesce_flush = false;
+	}
+
+	/* Queued data is segmented into frames of up to N1 bytes by the transmit scheduler */
+	if ((dlci->atomic_transmit == true) && (ring_buf_space_get(&dlci->transmit_rb) < size)) {
+		ret = 0;
+	} else {
+		ret = ring_buf_put(&dlci->transmit_rb, buf, size);
+	}
+
+	MODEM_CMUX_STATS_ADD(dlci, tx_rejected, size - ret);
+	MODEM_CMUX_STATS_MAX(dlci, transmit_buf_max, ring_buf_size_get(&dlci->transmit_rb));
+
+	k_mutex_unlock(&dlci->transmit_rb_lock);
+
+	if (ret > 0) {
+		modem_cmux_transmit_request(cmux);
 	}
+
+	return ret;
 }
 
-static void modem_cmux_on_dlci_frame_uih(struct modem_cmux_dlci *dlci)
+/* Called with receive buffer lock held once the pipe user has taken received data */
+static void modem_cmux_dlci_on_received_taken(struct modem_cmux_dlci *dlci, uint32_t taken)
 {
-	struct modem_cmux *cmux = dlci->cmux;
+	/* Allow remote to resume transmitting once receive buffer is drained */
+	if ((dlci->receive_rb_stopped == true) &&
+	    (modem_cmux_dlci_receive_len(dlci) <= dlci->receive_rb_low_watermark) &&
+	    (modem_cmux_dlci_receive_bufs_low(dlci) == false)) {
+		dlci->receive_rb_stopped = !modem_cmux_transmit_msc_command(
+			dlci->cmux, dlci, dlci->local_signals);
+	}
 
-	if (dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) {
-		LOG_DBG("Unexpected UIH frame");
+	if ((dlci->receive_rb_overrun == true) &&
+	    (modem_cmux_dlci_receive_len(dlci) <= dlci->receive_rb_low_watermark)) {
+		dlci->receive_rb_overrun = false;
+	}
 
-		return;
+	/* Tell remote that I frames can be received again */
+	if ((dlci->local_busy == true) && (taken > 0)) {
+		k_mutex_lock(&dlci->cmux->transmit_rb_lock, K_FOREVER);
+
+		dlci->local_busy = false;
+		dlci->ack_pending = true;
+
+		k_mutex_unlock(&dlci->cmux->transmit_rb_lock);
+
+		k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->cmux->transmit_work.dwork,
+					  K_NO_WAIT);
 	}
+}
+
+static int modem_cmux_dlci_pipe_api_receive(void *data, uint8_t *buf, uint32_t size)
+{
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	uint32_t ret;
 
 	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 
-	ring_buf_put(&dlci->receive_rb, cmux->frame.data, cmux->frame.data_len);
+	ret = modem_cmux_dlci_receive_get(dlci, buf, size);
+
+	modem_cmux_dlci_on_received_taken(dlci, ret);
 
 	k_mutex_unlock(&dlci->receive_rb_lock);
 
-	modem_pipe_notify_receive_ready(&dlci->pipe);
+	return ret;
 }
 
-static void modem_cmux_on_dlci_frame(struct modem_cmux *cmux)
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+static int modem_cmux_dlci_pipe_api_receive_buf(void *data, struct net_buf **buf)
 {
-	struct modem_cmux_dlci *dlci;
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	sys_snode_t *node;
 
-	dlci = modem_cmux_find_dlci(cmux);
+	if (dlci->receive_buf_pool == NULL) {
+		return -ENOTSUP;
+	}
 
-	if (dlci == NULL) {
-		LOG_WRN("Could not find DLCI: %u", cmux->frame.dlci_address);
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 
-		return;
+	node = sys_slist_get(&dlci->receive_bufs);
+
+	if (node == NULL) {
+		k_mutex_unlock(&dlci->receive_rb_lock);
+
+		return -EAGAIN;
 	}
 
-	switch (cmux->frame.type) {
-	case MODEM_CMUX_FRAME_TYPE_UA:
-		modem_cmux_on_dlci_frame_ua(dlci);
+	*buf = CONTAINER_OF(node, struct net_buf, node);
 
-		break;
+	dlci->receive_bufs_len -= (*buf)->len;
+	dlci->receive_bufs_count--;
 
-	case MODEM_CMUX_FRAME_TYPE_UIH:
-		modem_cmux_on_dlci_frame_uih(dlci);
+	modem_cmux_dlci_on_received_taken(dlci, (*buf)->len);
 
-		break;
+	k_mutex_unlock(&dlci->receive_rb_lock);
 
-	default:
-		modem_cmux_log_unknown_frame(cmux);
+	return 0;
+}
+#endif
 
-		break;
+static int modem_cmux_dlci_pipe_api_close(void *data)
+{
+	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+
+	if (k_work_delayable_is_pending(&dlci->close_work.dwork) == true) {
+		return -EBUSY;
 	}
+
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->close_work.dwork, K_NO_WAIT);
+
+	return 0;
 }
 
-static void modem_cmux_on_frame(struct modem_cmux *cmux)
+struct modem_pipe_api modem_cmux_dlci_pipe_api = {
+	.open = modem_cmux_dlci_pipe_api_open,
+	.transmit = modem_cmux_dlci_pipe_api_transmit,
+	.receive = modem_cmux_dlci_pipe_api_receive,
+	.close = modem_cmux_dlci_pipe_api_close,
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	.receive_buf = modem_cmux_dlci_pipe_api_receive_buf,
+#endif
+};
+
+/* Retransmit unacknowledged I frames when acknowledgement timer T1 expires */
+static void modem_cmux_dlci_retransmit_handler(struct k_work *item)
 {
-	if (cmux->frame.dlci_address == 0) {
-		modem_cmux_on_control_frame(cmux);
+	struct modem_cmux_dlci_work *dlci_work = (struct modem_cmux_dlci_work *)item;
+	struct modem_cmux_dlci *dlci = dlci_work->dlci;
+	struct modem_cmux *cmux = dlci->cmux;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if ((dlci->state != MODEM_CMUX_DLCI_STATE_OPEN) || (dlci->ack_seq == dlci->send_seq_end)) {
+		k_mutex_unlock(&cmux->transmit_rb_lock);
 
 		return;
 	}
 
-	modem_cmux_on_dlci_frame(cmux);
+	dlci->retransmit_count++;
+
+	/* Remote is considered unable to receive, close DLCI rather than retransmit forever */
+	if (dlci->retransmit_count > modem_cmux_pn_n2(cmux)) {
+		LOG_ERR("DLCI %u I frame %u not acknowledged after %u retransmissions, closing",
+			dlci->dlci_address, dlci->ack_seq, modem_cmux_pn_n2(cmux));
+
+		dlci->state = MODEM_CMUX_DLCI_STATE_CLOSING;
+		dlci->command_attempts = 0;
+
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		k_work_schedule_for_queue(cmux->work_q, &dlci->close_work.dwork, K_NO_WAIT);
+
+		return;
+	}
+
+	dlci->send_seq = dlci->ack_seq;
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	k_work_schedule_for_queue(cmux->work_q, &cmux->transmit_work.dwork, K_NO_WAIT);
 }
 
-static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t byte)
+/* PN command is retransmitted every T2 unless N2 retransmissions have not been answered */
+static bool modem_cmux_dlci_negotiate(struct modem_cmux_dlci *dlci)
 {
-	uint8_t fcs;
-	static const uint8_t resync[3] = {0xF9, 0xF9, 0xF9};
+	if (modem_cmux_command_attempt(dlci->cmux, &dlci->command_attempts) == false) {
+		return false;
+	}
 
-	switch (cmux->receive_state) {
-	case MODEM_CMUX_RECEIVE_STATE_SOF:
-		if (byte == 0xF9) {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_ADDRESS;
+	modem_cmux_transmit_pn_command(dlci->cmux, dlci, true);
 
-			break;
-		}
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->open_work.dwork,
+				  K_MSEC(modem_cmux_t2_timeout_ms(dlci->cmux)));
 
-		/* Send resync flags */
-		modem_pipe_transmit(cmux->pipe, resync, sizeof(resync));
+	return true;
+}
 
-		/* Await resync flags */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
+static void modem_cmux_dlci_open_handler(struct k_work *item)
+{
+	struct modem_cmux_dlci_work *dlci_work = (struct modem_cmux_dlci_work *)item;
 
-		break;
+	struct modem_cmux_dlci *dlci = dlci_work->dlci;
 
-	case MODEM_CMUX_RECEIVE_STATE_RESYNC_0:
-		if (byte == 0xF9) {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_1;
+	/* Responder DLCI is opened by SABM frame from initiator */
+	if (dlci->cmux->role == MODEM_CMUX_ROLE_RESPONDER) {
+		if (dlci->state == MODEM_CMUX_DLCI_STATE_OPEN) {
+			modem_pipe_notify_opened(&dlci->pipe);
 		}
 
-		break;
+		return;
+	}
 
-	case MODEM_CMUX_RECEIVE_STATE_RESYNC_1:
-		if (byte == 0xF9) {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_2;
-		} else {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
+	switch (dlci->state) {
+	case MODEM_CMUX_DLCI_STATE_NEGOTIATING:
+		if (modem_cmux_dlci_negotiate(dlci) == true) {
+			return;
 		}
 
-		break;
+		LOG_DBG("PN not answered, opening DLCI %u with default parameters",
+			dlci->dlci_address);
 
-	case MODEM_CMUX_RECEIVE_STATE_RESYNC_2:
-		if (byte == 0xF9) {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_3;
-		} else {
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_RESYNC_0;
-		}
+		dlci->command_attempts = 0;
 
 		break;
 
-	case MODEM_CMUX_RECEIVE_STATE_RESYNC_3:
-		if (byte == 0xF9) {
-			break;
-		}
+	case MODEM_CMUX_DLCI_STATE_OPENING:
+		break;
 
-	case MODEM_CMUX_RECEIVE_STATE_ADDRESS:
-		/* Initialize */
-		cmux->receive_buf_len = 0;
-		cmux->frame_header_len = 0;
+	default:
+		dlci->remote_signals = 0;
+		dlci->remote_line_status = 0;
+		dlci->command_attempts = 0;
 
-		/* Store header for FCS */
-		cmux->frame_header[cmux->frame_header_len] = byte;
-		cmux->frame_header_len++;
+		modem_cmux_dlci_reset_error_recovery(dlci);
 
-		/* Get CR */
-		cmux->frame.cr = (byte & 0x02) ? true : false;
+		k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 
-		/* Get DLCI address */
-		cmux->frame.dlci_address = (byte >> 2) & 0x3F;
+		dlci->receive_rb_stopped = false;
+		dlci->receive_rb_overrun = false;
 
-		/* Await control */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_CONTROL;
+		k_mutex_unlock(&dlci->receive_rb_lock);
+
+		if (dlci->negotiate == true) {
+			dlci->state = MODEM_CMUX_DLCI_STATE_NEGOTIATING;
+
+			modem_cmux_dlci_negotiate(dlci);
+
+			return;
+		}
 
 		break;
+	}
 
-	case MODEM_CMUX_RECEIVE_STATE_CONTROL:
-		/* Store header for FCS */
-		cmux->frame_header[cmux->frame_header_len] = byte;
-		cmux->frame_header_len++;
+	if (modem_cmux_command_attempt(dlci->cmux, &dlci->command_attempts) == false) {
+		LOG_WRN("DLCI %u SABM not answered after %u retransmissions", dlci->dlci_address,
+			dlci->cmux->n2);
 
-		/* Get PF */
-		cmux->frame.pf = (byte & MODEM_CMUX_PF) ? true : false;
+		dlci->state = MODEM_CMUX_DLCI_STATE_CLOSED;
 
-		/* Get frame type */
-		cmux->frame.type = byte & (~MODEM_CMUX_PF);
+		modem_cmux_dlci_free_bufs(dlci);
 
-		/* Await data length */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_LENGTH;
+		modem_pipe_notify_closed(&dlci->pipe);
 
-		break;
+		modem_cmux_dlcis_opening_remove(dlci->cmux, BIT64(dlci->dlci_address));
 
-	case MODEM_CMUX_RECEIVE_STATE_LENGTH:
-		/* Store header for FCS */
-		cmux->frame_header[cmux->frame_header_len] = byte;
-		cmux->frame_header_len++;
+		return;
+	}
 
-		/* Get first 7 bits of data length */
-		cmux->frame.data_len = (byte >> 1);
+	dlci->state = MODEM_CMUX_DLCI_STATE_OPENING;
 
-		/* Check if length field continues */
-		if ((byte & MODEM_CMUX_EA) == 0) {
-			/* Await continued length field */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_LENGTH_CONT;
+	struct modem_cmux_frame frame = {
+		.dlci_address = dlci->dlci_address,
+		.cr = true,
+		.pf = true,
+		.type = MODEM_CMUX_FRAME_TYPE_SABM,
+		.data = NULL,
+		.data_len = 0,
+	};
 
-			break;
-		}
+	modem_cmux_transmit_cmd_frame(dlci->cmux, &frame);
 
-		/* Check if no data field */
-		if (cmux->frame.data_len == 0) {
-			/* Await FCS */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+	dlci->command_sent_ticks = k_uptime_ticks();
 
-			break;
-		}
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->open_work.dwork,
+				  modem_cmux_t1_timeout(dlci->cmux));
+}
 
-		/* Await data */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
+static void modem_cmux_dlci_close_handler(struct k_work *item)
+{
+	struct modem_cmux_dlci_work *dlci_work = (struct modem_cmux_dlci_work *)item;
 
-		break;
+	struct modem_cmux_dlci *dlci = dlci_work->dlci;
+	struct modem_cmux *cmux = dlci->cmux;
 
-	case MODEM_CMUX_RECEIVE_STATE_LENGTH_CONT:
-		/* Store header for FCS */
-		cmux->frame_header[cmux->frame_header_len] = byte;
-		cmux->frame_header_len++;
+	if (dlci->state != MODEM_CMUX_DLCI_STATE_CLOSING) {
+		dlci->command_attempts = 0;
+	}
 
-		/* Get last 8 bits of data length */
-		cmux->frame.data_len |= ((uint16_t)byte) << 7;
+	/* DLCI is considered closed by remote if DISC is not answered */
+	if (modem_cmux_command_attempt(cmux, &dlci->command_attempts) == false) {
+		LOG_WRN("DLCI %u DISC not answered after %u retransmissions", dlci->dlci_address,
+			cmux->n2);
 
-		/* Await data */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DATA;
+		modem_cmux_dlci_on_closed(dlci);
 
-		break;
+		return;
+	}
 
-	case MODEM_CMUX_RECEIVE_STATE_DATA:
-		/* Copy byte to data */
-		cmux->receive_buf[cmux->receive_buf_len] = byte;
-		cmux->receive_buf_len++;
+	dlci->state = MODEM_CMUX_DLCI_STATE_CLOSING;
 
-		/* Check if datalen reached */
-		if (cmux->frame.data_len == cmux->receive_buf_len) {
-			/* Await FCS */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_FCS;
+	struct modem_cmux_frame frame = {
+		.dlci_address = dlci->dlci_address,
+		.cr = true,
+		.pf = true,
+		.type = MODEM_CMUX_FRAME_TYPE_DISC,
+		.data = NULL,
+		.data_len = 0,
+	};
 
-			break;
-		}
+	modem_cmux_transmit_cmd_frame(cmux, &frame);
 
-		/* Check if receive buffer overrun */
-		if (cmux->receive_buf_len == cmux->receive_buf_size) {
-			LOG_DBG("Receive buf overrun");
+	dlci->command_sent_ticks = k_uptime_ticks();
 
-			/* Drop frame */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_EOF;
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->close_work.dwork,
+				  modem_cmux_t1_timeout(cmux));
+}
 
-			break;
-		}
+static void modem_cmux_dlci_pipes_notify_closed(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
 
-		break;
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
 
-	case MODEM_CMUX_RECEIVE_STATE_FCS:
-		/* Compute FCS */
-		if (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_UIH) {
-			fcs = 0xFF - crc8(cmux->frame_header, cmux->frame_header_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
-					  true);
-		} else {
-			fcs = crc8(cmux->frame_header, cmux->frame_header_len,
-				   MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+		modem_pipe_notify_closed(&dlci->pipe);
+	}
+}
 
-			fcs = 0xFF - crc8(cmux->frame.data, cmux->frame.data_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
-		}
+void modem_cmux_executor_start(struct modem_cmux_executor *executor, k_thread_stack_t *stack,
+			       size_t stack_size, int priority)
+{
+	const struct k_work_queue_config work_q_config = {
+		.name = "modem_cmux",
+	};
 
-		/* Validate FCS */
-		if (fcs != byte) {
-			LOG_WRN("Frame FCS error");
+	__ASSERT_NO_MSG(executor != NULL);
+	__ASSERT_NO_MSG(stack != NULL);
 
-			/* Drop frame */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_DROP;
+	k_work_queue_init(&executor->work_q);
+	k_work_queue_start(&executor->work_q, stack, stack_size, priority, &work_q_config);
+}
 
-			break;
-		}
+void modem_cmux_init(struct modem_cmux *cmux, const struct modem_cmux_config *config)
+{
+	__ASSERT_NO_MSG(cmux != NULL);
+	__ASSERT_NO_MSG(config != NULL);
+	__ASSERT_NO_MSG(config->receive_buf != NULL);
+	__ASSERT_NO_MSG(config->receive_buf_size >= 126);
+	__ASSERT_NO_MSG(config->transmit_buf != NULL);
+	__ASSERT_NO_MSG(config->transmit_buf_size >= 148);
+	__ASSERT_NO_MSG((config->transmit_stage_buf == NULL) ||
+			(config->transmit_stage_buf_size >= MODEM_CMUX_FRAME_SIZE_MAX));
 
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_EOF;
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+	k_mutex_lock(&modem_cmux_instances_lock, K_FOREVER);
+	sys_slist_find_and_remove(&modem_cmux_instances, &cmux->node);
+	k_mutex_unlock(&modem_cmux_instances_lock);
+#endif
 
-		break;
+	memset(cmux, 0x00, sizeof(*cmux));
 
-	case MODEM_CMUX_RECEIVE_STATE_DROP:
-		LOG_WRN("Dropped frame");
+	cmux->callback = config->callback;
+	cmux->user_data = config->user_data;
+	cmux->option = config->option;
+	cmux->role = config->role;
+	cmux->t1_timeout_ms = (config->t1_timeout_ms == 0) ? MODEM_CMUX_T1_TIMEOUT_MS
+							    : config->t1_timeout_ms;
+	cmux->t2_timeout_ms = (config->t2_timeout_ms == 0) ? MODEM_CMUX_T2_TIMEOUT_MS
+							    : config->t2_timeout_ms;
+	cmux->adaptive_t1_timeout_ms = cmux->t1_timeout_ms;
+	cmux->n2 = config->n2;
+	cmux->adaptive_timeouts = config->adaptive_timeouts;
+	cmux->direct_transmit = config->direct_transmit;
+	cmux->work_q = (config->executor == NULL) ? &k_sys_work_q : &config->executor->work_q;
+	cmux->receive_budget = (config->receive_budget == 0) ? MODEM_CMUX_RECEIVE_BUDGET_DEFAULT
+							     : config->receive_budget;
+	cmux->power_save_timeout_ms = config->power_save_timeout_ms;
+	cmux->keepalive_interval_ms = config->keepalive_interval_ms;
+	cmux->receive_buf = config->receive_buf;
+	cmux->receive_buf_size = config->receive_buf_size;
+	cmux->transmit_stage_buf = config->transmit_stage_buf;
+	cmux->transmit_stage_buf_size = config->transmit_stage_buf_size;
+	cmux->dlci_table = config->dlci_table;
+	cmux->dlci_table_size = (config->dlci_table == NULL) ? 0 : config->dlci_table_size;
 
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+	sys_slist_init(&cmux->dlcis);
 
-		break;
+	for (uint8_t i = 0; i < cmux->dlci_table_size; i++) {
+		cmux->dlci_table[i] = NULL;
+	}
 
-	case MODEM_CMUX_RECEIVE_STATE_EOF:
-		/* Validate byte is EOF */
-		if (byte != 0xF9) {
-			/* Unexpected byte */
-			cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+	cmux->state = MODEM_CMUX_STATE_DISCONNECTED;
 
-			break;
-		}
+	ring_buf_init(&cmux->transmit_rb, config->transmit_buf_size, config->transmit_buf);
 
-		LOG_DBG("Received frame");
+	k_mutex_init(&cmux->transmit_rb_lock);
 
-		/* Process frame */
-		cmux->frame.data = cmux->receive_buf;
-		modem_cmux_on_frame(cmux);
+	cmux->receive_work.cmux = cmux;
+	k_work_init_delayable(&cmux->receive_work.dwork, modem_cmux_receive_handler);
 
-		/* Await start of next frame */
-		cmux->receive_state = MODEM_CMUX_RECEIVE_STATE_SOF;
+	cmux->transmit_work.cmux = cmux;
+	k_work_init_delayable(&cmux->transmit_work.dwork, modem_cmux_transmit_handler);
 
-		break;
+	cmux->connect_work.cmux = cmux;
+	k_work_init_delayable(&cmux->connect_work.dwork, modem_cmux_connect_handler);
 
-	default:
-		break;
-	}
-}
+	cmux->disconnect_work.cmux = cmux;
+	k_work_init_delayable(&cmux->disconnect_work.dwork, modem_cmux_disconnect_handler);
 
-static void modem_cmux_receive_handler(struct k_work *item)
-{
-	struct modem_cmux_work *cmux_process = (struct modem_cmux_work *)item;
-	struct modem_cmux *cmux = cmux_process->cmux;
-	uint8_t buf[16];
-	int ret;
+	cmux->power_save_work.cmux = cmux;
+	k_work_init_delayable(&cmux->power_save_work.dwork, modem_cmux_power_save_handler);
 
-	/* Receive data from pipe */
-	ret = modem_pipe_receive(cmux->pipe, buf, sizeof(buf));
+	cmux->wake_up_work.cmux = cmux;
+	k_work_init_delayable(&cmux->wake_up_work.dwork, modem_cmux_wake_up_handler);
 
-	if (ret < 1) {
-		return;
-	}
+	cmux->keepalive_work.cmux = cmux;
+	k_work_init_delayable(&cmux->keepalive_work.dwork, modem_cmux_keepalive_handler);
 
-	/* Process received data */
-	for (uint16_t i = 0; i < (uint16_t)ret; i++) {
-		modem_cmux_process_received_byte(cmux, buf[i]);
-	}
+	cmux->coalesce_work.cmux = cmux;
+	k_work_init_delayable(&cmux->coalesce_work.dwork, modem_cmux_coalesce_handler);
+
+	k_event_init(&cmux->event);
+	k_event_post(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
 
-	/* Reschedule received work */
-	k_work_schedule(&cmux->receive_work.dwork, K_NO_WAIT);
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+	k_mutex_lock(&modem_cmux_instances_lock, K_FOREVER);
+	sys_slist_append(&modem_cmux_instances, &cmux->node);
+	k_mutex_unlock(&modem_cmux_instances_lock);
+#endif
 }
 
-static void modem_cmux_transmit_handler(struct k_work *item)
+struct modem_pipe *modem_cmux_dlci_init(struct modem_cmux *cmux, struct modem_cmux_dlci *dlci,
+					const struct modem_cmux_dlci_config *config)
 {
-	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
-	struct modem_cmux *cmux = cmux_work->cmux;
-	uint8_t *reserved;
-	uint32_t reserved_size;
-	int ret;
+	__ASSERT_NO_MSG(cmux != NULL);
+	__ASSERT_NO_MSG(dlci != NULL);
+	__ASSERT_NO_MSG(config != NULL);
+	__ASSERT_NO_MSG(config->dlci_address < 64);
+	__ASSERT_NO_MSG((config->receive_buf != NULL) != (config->buf_slab != NULL));
+	__ASSERT_NO_MSG(config->receive_buf_size >= 126);
+	__ASSERT_NO_MSG((config->transmit_buf != NULL) != (config->buf_slab != NULL));
+	__ASSERT_NO_MSG(config->transmit_buf_size >= MODEM_CMUX_DATA_SIZE_MIN);
+	__ASSERT_NO_MSG((config->receive_buf_pool == NULL) ||
+			IS_ENABLED(CONFIG_MODEM_CMUX_NET_BUF));
+	__ASSERT_NO_MSG((config->receive_buf_pool == NULL) || (config->error_recovery == false));
 
-	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+	memset(dlci, 0x00, sizeof(*dlci));
 
-	/* Reserve data to transmit from transmit ring buffer */
-	reserved_size = ring_buf_get_claim(&cmux->transmit_rb, &reserved, UINT32_MAX);
+	dlci->cmux = cmux;
 
-	/* Transmit reserved data */
-	ret = modem_pipe_transmit(cmux->pipe, reserved, reserved_size);
+	dlci->dlci_address = config->dlci_address;
 
-	if (ret < 1) {
-		ring_buf_get_finish(&cmux->transmit_rb, 0);
+	dlci->buf_slab = config->buf_slab;
+	dlci->receive_buf_size = config->receive_buf_size;
+	dlci->transmit_buf_size = config->transmit_buf_size;
 
-		k_mutex_unlock(&cmux->transmit_rb_lock);
+	/* Buffers are allocated from slab when opened */
+	ring_buf_init(&dlci->receive_rb,
+		      (dlci->buf_slab == NULL) ? config->receive_buf_size : 0,
+		      config->receive_buf);
 
-		k_work_schedule(&cmux->transmit_work.dwork, K_NO_WAIT);
+	k_mutex_init(&dlci->receive_rb_lock);
 
-		return;
-	}
+	dlci->receive_rb_high_watermark = (config->receive_buf_high_watermark == 0)
+					? ((config->receive_buf_size / 4) * 3)
+					: config->receive_buf_high_watermark;
 
-	/* Release remaining reserved data */
-	ring_buf_get_finish(&cmux->transmit_rb, ret);
+	dlci->receive_rb_low_watermark = (config->receive_buf_low_watermark == 0)
+				       ? (config->receive_buf_size / 4)
+				       : config->receive_buf_low_watermark;
 
-	/* Resubmit transmit work if data remains */
-	if (ring_buf_is_empty(&cmux->transmit_rb) == false) {
-		k_work_schedule(&cmux->transmit_work.dwork, K_NO_WAIT);
-	}
+	__ASSERT_NO_MSG(dlci->receive_rb_low_watermark < dlci->receive_rb_high_watermark);
 
-	k_mutex_unlock(&cmux->transmit_rb_lock);
-}
+	ring_buf_init(&dlci->transmit_rb,
+		      (dlci->buf_slab == NULL) ? config->transmit_buf_size : 0,
+		      config->transmit_buf);
 
-static void modem_cmux_connect_handler(struct k_work *item)
-{
-	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
-	struct modem_cmux *cmux = cmux_work->cmux;
+	k_mutex_init(&dlci->transmit_rb_lock);
 
-	cmux->state = MODEM_CMUX_STATE_CONNECTING;
+	dlci->priority = config->priority;
 
-	struct modem_cmux_frame frame = {
-		.dlci_address = 0,
-		.cr = true,
-		.pf = true,
-		.type = MODEM_CMUX_FRAME_TYPE_SABM,
-		.data = NULL,
-		.data_len = 0,
-	};
+	dlci->weight = (config->weight == 0) ? 1 : config->weight;
 
-	modem_cmux_transmit_cmd_frame(cmux, &frame);
+	dlci->negotiate = config->negotiate;
 
-	k_work_schedule(&cmux->connect_work.dwork, MODEM_CMUX_T1_TIMEOUT);
-}
+	dlci->local_signals = MODEM_CMUX_SIGNAL_RTC | MODEM_CMUX_SIGNAL_RTR;
 
-static void modem_cmux_disconnect_handler(struct k_work *item)
-{
-	struct modem_cmux_work *cmux_work = (struct modem_cmux_work *)item;
-	struct modem_cmux *cmux = cmux_work->cmux;
-	struct modem_cmux_command *command;
-	uint8_t data[2];
+	dlci->data_size_max = (config->data_size_max == 0) ? MODEM_CMUX_DATA_SIZE_DEFAULT
+							    : config->data_size_max;
 
-	cmux->state = MODEM_CMUX_STATE_DISCONNECTING;
+	dlci->data_size_max = (modem_cmux_receive_data_size_max(cmux) < dlci->data_size_max)
+			    ? modem_cmux_receive_data_size_max(cmux)
+			    : dlci->data_size_max;
 
-	command = modem_cmux_command_wrap(data);
-	command->type.ea = 1;
-	command->type.cr = 1;
-	command->type.value = MODEM_CMUX_COMMAND_CLD;
-	command->length.ea = 1;
-	command->length.value = 0;
+	dlci->error_recovery = config->error_recovery;
 
-	struct modem_cmux_frame frame = {
-		.dlci_address = 0,
-		.cr = true,
-		.pf = false,
-		.type = MODEM_CMUX_FRAME_TYPE_UIH,
-		.data = data,
-		.data_len = sizeof(data),
-	};
+	dlci->ui_frames = config->ui_frames;
 
-	/* Transmit close down command */
-	modem_cmux_transmit_cmd_frame(cmux, &frame);
+	dlci->atomic_transmit = config->atomic_transmit;
 
-	k_work_schedule(&cmux->disconnect_work.dwork, MODEM_CMUX_T1_TIMEOUT);
-}
+#if defined(CONFIG_MODEM_CMUX_NET_BUF)
+	dlci->receive_buf_pool = config->receive_buf_pool;
+	sys_slist_init(&dlci->receive_bufs);
+#endif
 
-static int modem_cmux_dlci_pipe_api_open(void *data)
-{
-	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	dlci->window_size = (config->window_size == 0) ? MODEM_CMUX_PN_K_DEFAULT
+						       : config->window_size;
 
-	if (k_work_delayable_is_pending(&dlci->open_work.dwork) == true) {
-		return -EBUSY;
-	}
+	__ASSERT_NO_MSG(dlci->window_size <= MODEM_CMUX_WINDOW_SIZE_MAX);
 
-	k_work_schedule(&dlci->open_work.dwork, K_NO_WAIT);
+	dlci->coalesce_timeout_ticks = k_us_to_ticks_ceil32(config->coalesce_timeout_us);
 
-	return 0;
-}
+	dlci->coalesce_size = ((config->coalesce_size == 0) ||
+			       (dlci->data_size_max < config->coalesce_size))
+			    ? dlci->data_size_max
+			    : config->coalesce_size;
 
-static int modem_cmux_dlci_pipe_api_transmit(void *data, const uint8_t *buf, uint32_t size)
-{
-	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
-	struct modem_cmux *cmux = dlci->cmux;
+	modem_pipe_init(&dlci->pipe, dlci, &modem_cmux_dlci_pipe_api);
 
-	struct modem_cmux_frame frame = {
-		.dlci_address = dlci->dlci_address,
-		.cr = false,
-		.pf = false,
-		.type = MODEM_CMUX_FRAME_TYPE_UIH,
-		.data = buf,
-		.data_len = size,
-	};
+	dlci->open_work.dlci = dlci;
+	k_work_init_delayable(&dlci->open_work.dwork, modem_cmux_dlci_open_handler);
 
-	return modem_cmux_transmit_data_frame(cmux, &frame);
-}
+	dlci->close_work.dlci = dlci;
+	k_work_init_delayable(&dlci->close_work.dwork, modem_cmux_dlci_close_handler);
 
-static int modem_cmux_dlci_pipe_api_receive(void *data, uint8_t *buf, uint32_t size)
-{
-	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
-	uint32_t ret;
+	dlci->retransmit_work.dlci = dlci;
+	k_work_init_delayable(&dlci->retransmit_work.dwork, modem_cmux_dlci_retransmit_handler);
 
-	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
+	dlci->state = MODEM_CMUX_DLCI_STATE_CLOSED;
 
-	ret = ring_buf_get(&dlci->receive_rb, buf, size);
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
 
-	k_mutex_unlock(&dlci->receive_rb_lock);
+	sys_slist_append(&cmux->dlcis, &dlci->node);
 
-	return ret;
+	if (dlci->dlci_address < cmux->dlci_table_size) {
+		cmux->dlci_table[dlci->dlci_address] = dlci;
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	return &dlci->pipe;
 }
 
-static int modem_cmux_dlci_pipe_api_close(void *data)
+int modem_cmux_dlci_deinit(struct modem_cmux_dlci *dlci)
 {
-	struct modem_cmux_dlci *dlci = (struct modem_cmux_dlci *)data;
+	struct modem_cmux *cmux = dlci->cmux;
+	struct k_work_sync sync;
 
-	if (k_work_delayable_is_pending(&dlci->close_work.dwork) == true) {
+	if (dlci->state != MODEM_CMUX_DLCI_STATE_CLOSED) {
 		return -EBUSY;
 	}
 
-	k_work_schedule(&dlci->close_work.dwork, K_NO_WAIT);
-
-	return 0;
-}
+	k_work_cancel_delayable_sync(&dlci->open_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&dlci->close_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&dlci->retransmit_work.dwork, &sync);
 
-struct modem_pipe_api modem_cmux_dlci_pipe_api = {
-	.open = modem_cmux_dlci_pipe_api_open,
-	.transmit = modem_cmux_dlci_pipe_api_transmit,
-	.receive = modem_cmux_dlci_pipe_api_receive,
-	.close = modem_cmux_dlci_pipe_api_close,
-};
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
 
-static void modem_cmux_dlci_open_handler(struct k_work *item)
-{
-	struct modem_cmux_dlci_work *dlci_work = (struct modem_cmux_dlci_work *)item;
+	sys_slist_find_and_remove(&cmux->dlcis, &dlci->node);
 
-	struct modem_cmux_dlci *dlci = dlci_work->dlci;
+	if ((dlci->dlci_address < cmux->dlci_table_size) &&
+	    (cmux->dlci_table[dlci->dlci_address] == dlci)) {
+		cmux->dlci_table[dlci->dlci_address] = NULL;
+	}
 
-	dlci->state = MODEM_CMUX_DLCI_STATE_OPENING;
+	if (cmux->transmit_dlci == dlci) {
+		cmux->transmit_dlci = NULL;
+	}
 
-	struct modem_cmux_frame frame = {
-		.dlci_address = dlci->dlci_address,
-		.cr = true,
-		.pf = true,
-		.type = MODEM_CMUX_FRAME_TYPE_SABM,
-		.data = NULL,
-		.data_len = 0,
-	};
+	k_mutex_unlock(&cmux->transmit_rb_lock);
 
-	modem_cmux_transmit_cmd_frame(dlci->cmux, &frame);
+	modem_cmux_dlci_free_bufs(dlci);
 
-	k_work_schedule(&dlci->open_work.dwork, MODEM_CMUX_T1_TIMEOUT);
+	return 0;
 }
 
-static void modem_cmux_dlci_close_handler(struct k_work *item)
+void modem_cmux_dlci_flush(struct modem_cmux_dlci *dlci)
 {
-	struct modem_cmux_dlci_work *dlci_work = (struct modem_cmux_dlci_work *)item;
-
-	struct modem_cmux_dlci *dlci = dlci_work->dlci;
-	struct modem_cmux *cmux = dlci->cmux;
+	if (dlci->coalesce_timeout_ticks == 0) {
+		return;
+	}
 
-	dlci->state = MODEM_CMUX_DLCI_STATE_CLOSING;
+	k_mutex_lock(&dlci->transmit_rb_lock, K_FOREVER);
 
-	struct modem_cmux_frame frame = {
-		.dlci_address = dlci->dlci_address,
-		.cr = true,
-		.pf = true,
-		.type = MODEM_CMUX_FRAME_TYPE_DISC,
-		.data = NULL,
-		.data_len = 0,
-	};
+	dlci->coalesce_flush = true;
 
-	modem_cmux_transmit_cmd_frame(cmux, &frame);
+	k_mutex_unlock(&dlci->transmit_rb_lock);
 
-	k_work_schedule(&dlci->close_work.dwork, MODEM_CMUX_T1_TIMEOUT);
+	k_work_schedule_for_queue(dlci->cmux->work_q, &dlci->cmux->transmit_work.dwork, K_NO_WAIT);
 }
 
-static void modem_cmux_dlci_pipes_notify_closed(struct modem_cmux *cmux)
+uint8_t modem_cmux_dlci_get_remote_signals(struct modem_cmux_dlci *dlci)
 {
-	sys_snode_t *node;
-	struct modem_cmux_dlci *dlci;
-
-	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
-		dlci = (struct modem_cmux_dlci *)node;
-
-		modem_pipe_notify_closed(&dlci->pipe);
-	}
+	return dlci->remote_signals;
 }
 
-void modem_cmux_init(struct modem_cmux *cmux, const struct modem_cmux_config *config)
+uint8_t modem_cmux_dlci_get_remote_line_status(struct modem_cmux_dlci *dlci)
 {
-	__ASSERT_NO_MSG(cmux != NULL);
-	__ASSERT_NO_MSG(config != NULL);
-	__ASSERT_NO_MSG(config->receive_buf != NULL);
-	__ASSERT_NO_MSG(config->receive_buf_size >= 126);
-	__ASSERT_NO_MSG(config->transmit_buf != NULL);
-	__ASSERT_NO_MSG(config->transmit_buf_size >= 148);
+	uint8_t line_status;
 
-	memset(cmux, 0x00, sizeof(*cmux));
+	k_mutex_lock(&dlci->cmux->transmit_rb_lock, K_FOREVER);
 
-	cmux->callback = config->callback;
-	cmux->user_data = config->user_data;
-	cmux->receive_buf = config->receive_buf;
-	cmux->receive_buf_size = config->receive_buf_size;
+	line_status = dlci->remote_line_status;
+	dlci->remote_line_status = 0;
 
-	sys_slist_init(&cmux->dlcis);
+	k_mutex_unlock(&dlci->cmux->transmit_rb_lock);
 
-	cmux->state = MODEM_CMUX_STATE_DISCONNECTED;
+	return line_status;
+}
 
-	ring_buf_init(&cmux->transmit_rb, config->transmit_buf_size, config->transmit_buf);
+int modem_cmux_dlci_set_signals(struct modem_cmux_dlci *dlci, uint8_t signals)
+{
+	int ret = 0;
 
-	k_mutex_init(&cmux->transmit_rb_lock);
+	k_mutex_lock(&dlci->receive_rb_lock, K_FOREVER);
 
-	cmux->receive_work.cmux = cmux;
-	k_work_init_delayable(&cmux->receive_work.dwork, modem_cmux_receive_handler);
+	dlci->local_signals = signals & MODEM_CMUX_SIGNALS_V24;
 
-	cmux->transmit_work.cmux = cmux;
-	k_work_init_delayable(&cmux->transmit_work.dwork, modem_cmux_transmit_handler);
+	if (dlci->state == MODEM_CMUX_DLCI_STATE_OPEN) {
+		signals = (dlci->receive_rb_stopped == true)
+			? (dlci->local_signals | MODEM_CMUX_SIGNAL_FC)
+			: dlci->local_signals;
 
-	cmux->connect_work.cmux = cmux;
-	k_work_init_delayable(&cmux->connect_work.dwork, modem_cmux_connect_handler);
+		if (modem_cmux_transmit_msc_command(dlci->cmux, dlci, signals) == false) {
+			ret = -ENOMEM;
+		}
+	}
 
-	cmux->disconnect_work.cmux = cmux;
-	k_work_init_delayable(&cmux->disconnect_work.dwork, modem_cmux_disconnect_handler);
+	k_mutex_unlock(&dlci->receive_rb_lock);
 
-	k_event_init(&cmux->event);
-	k_event_post(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT);
+	return ret;
 }
 
-struct modem_pipe *modem_cmux_dlci_init(struct modem_cmux *cmux, struct modem_cmux_dlci *dlci,
-					const struct modem_cmux_dlci_config *config)
+int modem_cmux_set_flow_control(struct modem_cmux *cmux, bool on)
 {
-	__ASSERT_NO_MSG(cmux != NULL);
-	__ASSERT_NO_MSG(dlci != NULL);
-	__ASSERT_NO_MSG(config != NULL);
-	__ASSERT_NO_MSG(config->dlci_address < 64);
-	__ASSERT_NO_MSG(config->receive_buf != NULL);
-	__ASSERT_NO_MSG(config->receive_buf_size >= 126);
-
-	memset(dlci, 0x00, sizeof(*dlci));
-
-	dlci->cmux = cmux;
-
-	dlci->dlci_address = config->dlci_address;
+	struct modem_cmux_command *command;
+	uint8_t data[2];
 
-	ring_buf_init(&dlci->receive_rb, config->receive_buf_size, config->receive_buf);
+	if (cmux->state != MODEM_CMUX_STATE_CONNECTED) {
+		return -EPERM;
+	}
 
-	k_mutex_init(&dlci->receive_rb_lock);
+	command = modem_cmux_command_wrap(data);
+	command->type.ea = 1;
+	command->type.cr = 1;
+	command->type.value = on ? MODEM_CMUX_COMMAND_FCON : MODEM_CMUX_COMMAND_FCOFF;
+	command->length.ea = 1;
+	command->length.value = 0;
 
-	modem_pipe_init(&dlci->pipe, dlci, &modem_cmux_dlci_pipe_api);
+	struct modem_cmux_frame frame = {
+		.dlci_address = 0,
+		.cr = true,
+		.pf = false,
+		.type = MODEM_CMUX_FRAME_TYPE_UIH,
+		.data = data,
+		.data_len = sizeof(data),
+	};
 
-	dlci->open_work.dlci = dlci;
-	k_work_init_delayable(&dlci->open_work.dwork, modem_cmux_dlci_open_handler);
+	if (modem_cmux_transmit_cmd_frame(cmux, &frame) == false) {
+		return -ENOMEM;
+	}
 
-	dlci->close_work.dlci = dlci;
-	k_work_init_delayable(&dlci->close_work.dwork, modem_cmux_dlci_close_handler);
+	return 0;
+}
 
-	dlci->state = MODEM_CMUX_DLCI_STATE_CLOSED;
+void modem_cmux_get_keepalive_stats(struct modem_cmux *cmux,
+				    struct modem_cmux_keepalive_stats *stats)
+{
+	memcpy(stats, &cmux->keepalive_stats, sizeof(*stats));
+}
 
-	sys_slist_append(&dlci->cmux->dlcis, &dlci->node);
+#if defined(CONFIG_MODEM_CMUX_STATISTICS)
+void modem_cmux_get_stats(struct modem_cmux *cmux, struct modem_cmux_stats *stats)
+{
+	memcpy(stats, &cmux->stats, sizeof(*stats));
+}
 
-	return &dlci->pipe;
+void modem_cmux_dlci_get_stats(struct modem_cmux_dlci *dlci, struct modem_cmux_dlci_stats *stats)
+{
+	memcpy(stats, &dlci->stats, sizeof(*stats));
 }
+#endif
 
 int modem_cmux_attach(struct modem_cmux *cmux, struct modem_pipe *pipe)
 {
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+
 	cmux->pipe = pipe;
 
 	ring_buf_reset(&cmux->transmit_rb);
 
+	cmux->transmit_stage_len = 0;
+	cmux->transmit_stage_split = 0;
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		ring_buf_reset(&dlci->transmit_rb);
+	}
+
+	cmux->transmit_dlci = NULL;
+
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+	/*
+	 * List instance again if released. The cellular driver attaches again on restart
+	 * without releasing, so the instance is removed first to not be listed twice.
+	 */
+	k_mutex_lock(&modem_cmux_instances_lock, K_FOREVER);
+	sys_slist_find_and_remove(&modem_cmux_instances, &cmux->node);
+	sys_slist_append(&modem_cmux_instances, &cmux->node);
+	k_mutex_unlock(&modem_cmux_instances_lock);
+#endif
+
 	modem_pipe_attach(cmux->pipe, modem_cmux_bus_callback, cmux);
 
 	return 0;
@@ -1077,11 +4151,12 @@ int modem_cmux_connect(struct modem_cmux *cmux)
 	}
 
 	if (k_work_delayable_is_pending(&cmux->connect_work.dwork) == false) {
-		k_work_schedule(&cmux->connect_work.dwork, K_NO_WAIT);
+		k_work_schedule_for_queue(cmux->work_q, &cmux->connect_work.dwork, K_NO_WAIT);
 	}
 
+	/* SABM and its retransmissions */
 	if (k_event_wait(&cmux->event, MODEM_CMUX_EVENT_CONNECTED_BIT, false,
-			 MODEM_CMUX_T2_TIMEOUT) == 0) {
+			 K_MSEC(modem_cmux_dlcis_timeout_ms(cmux, 1))) == 0) {
 		return -EAGAIN;
 	}
 
@@ -1096,7 +4171,7 @@ int modem_cmux_connect_async(struct modem_cmux *cmux)
 		return -EBUSY;
 	}
 
-	k_work_schedule(&cmux->connect_work.dwork, K_NO_WAIT);
+	k_work_schedule_for_queue(cmux->work_q, &cmux->connect_work.dwork, K_NO_WAIT);
 
 	return 0;
 }
@@ -1108,11 +4183,12 @@ int modem_cmux_disconnect(struct modem_cmux *cmux)
 	}
 
 	if (k_work_delayable_is_pending(&cmux->disconnect_work.dwork) == false) {
-		k_work_schedule(&cmux->disconnect_work.dwork, K_NO_WAIT);
+		k_work_schedule_for_queue(cmux->work_q, &cmux->disconnect_work.dwork, K_NO_WAIT);
 	}
 
+	/* CLD and its retransmissions */
 	if (k_event_wait(&cmux->event, MODEM_CMUX_EVENT_DISCONNECTED_BIT, false,
-			 MODEM_CMUX_T2_TIMEOUT) == 0) {
+			 K_MSEC(modem_cmux_dlcis_timeout_ms(cmux, 1))) == 0) {
 		return -EAGAIN;
 	}
 
@@ -1125,7 +4201,157 @@ int modem_cmux_disconnect_async(struct modem_cmux *cmux)
 		return -EBUSY;
 	}
 
-	k_work_schedule(&cmux->disconnect_work.dwork, K_NO_WAIT);
+	k_work_schedule_for_queue(cmux->work_q, &cmux->disconnect_work.dwork, K_NO_WAIT);
+
+	return 0;
+}
+
+int modem_cmux_dlcis_open_async(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+				uint8_t dlcis_size)
+{
+	uint64_t failed = 0;
+	int ret = 0;
+	int err;
+
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if (cmux->dlcis_opening != 0) {
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		return -EBUSY;
+	}
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		__ASSERT_NO_MSG(dlcis[i]->cmux == cmux);
+
+		if (dlcis[i]->state != MODEM_CMUX_DLCI_STATE_OPEN) {
+			cmux->dlcis_opening |= BIT64(dlcis[i]->dlci_address);
+		}
+	}
+
+	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_DLCIS_OPENED_BIT);
+
+	if (cmux->dlcis_opening == 0) {
+		k_event_post(&cmux->event, MODEM_CMUX_EVENT_DLCIS_OPENED_BIT);
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DLCIS_OPENED);
+
+		return 0;
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	/* Transmit all SABM frames before any UA frame is awaited */
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		if (dlcis[i]->state == MODEM_CMUX_DLCI_STATE_OPEN) {
+			continue;
+		}
+
+		err = modem_pipe_open_async(&dlcis[i]->pipe);
+
+		/* DLCI is already being opened if busy */
+		if ((err < 0) && (err != -EBUSY)) {
+			failed |= BIT64(dlcis[i]->dlci_address);
+			ret = err;
+		}
+	}
+
+	if (failed != 0) {
+		modem_cmux_dlcis_opening_remove(cmux, failed);
+	}
+
+	return ret;
+}
+
+int modem_cmux_dlcis_open(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+			  uint8_t dlcis_size)
+{
+	uint32_t timeout_ms;
+	int ret;
+
+	ret = modem_cmux_dlcis_open_async(cmux, dlcis, dlcis_size);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* PN exchange awaits T2 and SABM exchange T1 for each transmission */
+	timeout_ms = (modem_cmux_t2_timeout_ms(cmux) * (modem_cmux_pn_n2(cmux) + 1)) +
+		     modem_cmux_dlcis_timeout_ms(cmux, 1);
+
+	if (k_event_wait(&cmux->event, MODEM_CMUX_EVENT_DLCIS_OPENED_BIT, false,
+			 K_MSEC(timeout_ms)) == 0) {
+		return -EAGAIN;
+	}
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		if (dlcis[i]->state != MODEM_CMUX_DLCI_STATE_OPEN) {
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+int modem_cmux_dlcis_close_async(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+				 uint8_t dlcis_size)
+{
+	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
+
+	if (cmux->dlcis_closing != 0) {
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		return -EBUSY;
+	}
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		__ASSERT_NO_MSG(dlcis[i]->cmux == cmux);
+
+		if (dlcis[i]->state != MODEM_CMUX_DLCI_STATE_CLOSED) {
+			cmux->dlcis_closing |= BIT64(dlcis[i]->dlci_address);
+		}
+	}
+
+	k_event_clear(&cmux->event, MODEM_CMUX_EVENT_DLCIS_CLOSED_BIT);
+
+	if (cmux->dlcis_closing == 0) {
+		k_event_post(&cmux->event, MODEM_CMUX_EVENT_DLCIS_CLOSED_BIT);
+		k_mutex_unlock(&cmux->transmit_rb_lock);
+
+		modem_cmux_raise_event(cmux, MODEM_CMUX_EVENT_DLCIS_CLOSED);
+
+		return 0;
+	}
+
+	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	/* Transmit all DISC frames before any UA frame is awaited, busy DLCI is already closing */
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		if (dlcis[i]->state != MODEM_CMUX_DLCI_STATE_CLOSED) {
+			modem_pipe_close_async(&dlcis[i]->pipe);
+		}
+	}
+
+	return 0;
+}
+
+int modem_cmux_dlcis_close(struct modem_cmux *cmux, struct modem_cmux_dlci *const *dlcis,
+			   uint8_t dlcis_size)
+{
+	int ret;
+
+	ret = modem_cmux_dlcis_close_async(cmux, dlcis, dlcis_size);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* DISC exchange */
+	if (k_event_wait(&cmux->event, MODEM_CMUX_EVENT_DLCIS_CLOSED_BIT, false,
+			 K_MSEC(modem_cmux_dlcis_timeout_ms(cmux, 1))) == 0) {
+		return -EAGAIN;
+	}
 
 	return 0;
 }
@@ -1133,6 +4359,8 @@ int modem_cmux_disconnect_async(struct modem_cmux *cmux)
 void modem_cmux_release(struct modem_cmux *cmux)
 {
 	struct k_work_sync sync;
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
 
 	/* Close DLCI pipes */
 	modem_cmux_dlci_pipes_notify_closed(cmux);
@@ -1143,9 +4371,123 @@ void modem_cmux_release(struct modem_cmux *cmux)
 	/* Cancel all work */
 	k_work_cancel_delayable_sync(&cmux->connect_work.dwork, &sync);
 	k_work_cancel_delayable_sync(&cmux->disconnect_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&cmux->coalesce_work.dwork, &sync);
 	k_work_cancel_delayable_sync(&cmux->transmit_work.dwork, &sync);
 	k_work_cancel_delayable_sync(&cmux->receive_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&cmux->power_save_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&cmux->wake_up_work.dwork, &sync);
+	k_work_cancel_delayable_sync(&cmux->keepalive_work.dwork, &sync);
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		k_work_cancel_delayable_sync(&dlci->open_work.dwork, &sync);
+		k_work_cancel_delayable_sync(&dlci->close_work.dwork, &sync);
+		k_work_cancel_delayable_sync(&dlci->retransmit_work.dwork, &sync);
+	}
 
 	/* Unreference pipe */
 	cmux->pipe = NULL;
+
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+	k_mutex_lock(&modem_cmux_instances_lock, K_FOREVER);
+	sys_slist_find_and_remove(&modem_cmux_instances, &cmux->node);
+	k_mutex_unlock(&modem_cmux_instances_lock);
+#endif
+}
+
+int modem_cmux_init_internal(struct modem_cmux *cmux, const struct modem_cmux_config *config,
+			     struct modem_cmux_dlci *dlcis,
+			     const struct modem_cmux_dlci_config *dlci_configs, uint8_t dlcis_size,
+			     uint8_t *dlci_bufs, uint16_t dlci_buf_size)
+{
+	struct modem_cmux_dlci_config dlci_config;
+	uint8_t *dlci_buf;
+
+	/* DLCIs are accessed by address in block and DLCI table */
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		if (dlci_configs[i].dlci_address != (i + 1)) {
+			LOG_ERR("DLCI config %u has address %u, expected %u", i,
+				dlci_configs[i].dlci_address, i + 1);
+
+			return -EINVAL;
+		}
+	}
+
+	modem_cmux_init(cmux, config);
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		dlci_buf = &dlci_bufs[i * 2 * dlci_buf_size];
+
+		dlci_config = dlci_configs[i];
+		dlci_config.receive_buf = dlci_buf;
+		dlci_config.receive_buf_size = dlci_buf_size;
+		dlci_config.transmit_buf = &dlci_buf[dlci_buf_size];
+		dlci_config.transmit_buf_size = dlci_buf_size;
+		dlci_config.buf_slab = NULL;
+
+		modem_cmux_dlci_init(cmux, &dlcis[i], &dlci_config);
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_MODEM_CMUX_SHELL)
+static void modem_cmux_shell_print_stats(const struct shell *sh, struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+	struct modem_cmux_stats stats;
+	struct modem_cmux_dlci_stats dlci_stats;
+
+	modem_cmux_get_stats(cmux, &stats);
+
+	shell_print(sh, "CMUX %p", (void *)cmux);
+	shell_print(sh, "  frames rx %u tx %u", stats.rx_frames, stats.tx_frames);
+	shell_print(sh, "  fcs errors %u resyncs %u dropped %u unknown dlci %u",
+		    stats.fcs_errors, stats.resyncs, stats.dropped_frames,
+		    stats.unknown_dlci_frames);
+	shell_print(sh, "  tx rejected %u", stats.tx_rejected);
+	shell_print(sh, "  receive buf max %u/%u transmit buf max %u/%u",
+		    stats.receive_buf_max, cmux->receive_buf_size, stats.transmit_buf_max,
+		    ring_buf_capacity_get(&cmux->transmit_rb));
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+
+		modem_cmux_dlci_get_stats(dlci, &dlci_stats);
+
+		shell_print(sh, "  DLCI %u", dlci->dlci_address);
+		shell_print(sh, "    rx frames %u bytes %u dropped %u", dlci_stats.rx_frames,
+			    dlci_stats.rx_bytes, dlci_stats.rx_dropped);
+		shell_print(sh, "    tx frames %u bytes %u rejected %u", dlci_stats.tx_frames,
+			    dlci_stats.tx_bytes, dlci_stats.tx_rejected);
+		shell_print(sh, "    receive buf max %u/%u transmit buf max %u/%u",
+			    dlci_stats.receive_buf_max, ring_buf_capacity_get(&dlci->receive_rb),
+			    dlci_stats.transmit_buf_max,
+			    ring_buf_capacity_get(&dlci->transmit_rb));
+	}
+}
+
+static int modem_cmux_shell_cmd_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	sys_snode_t *node;
+
+	k_mutex_lock(&modem_cmux_instances_lock, K_FOREVER);
+
+	SYS_SLIST_FOR_EACH_NODE(&modem_cmux_instances, node) {
+		modem_cmux_shell_print_stats(sh, CONTAINER_OF(node, struct modem_cmux, node));
+	}
+
+	k_mutex_unlock(&modem_cmux_instances_lock);
+
+	return 0;
 }
+
+SHELL_STATIC_SUBCMD_SET_CREATE(modem_cmux_shell_cmds,
+	SHELL_CMD(stats, NULL, "Print CMUX and DLCI statistics", modem_cmux_shell_cmd_stats),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(modem_cmux, &modem_cmux_shell_cmds, "Modem CMUX commands", NULL);
+#endif
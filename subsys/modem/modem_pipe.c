@@ -109,6 +109,29 @@ int modem_pipe_receive(struct modem_pipe *pipe, uint8_t *buf, size_t size)
 	return ret;
 }
 
+int modem_pipe_receive_buf(struct modem_pipe *pipe, struct net_buf **buf)
+{
+	int ret;
+
+	if (pipe->api->receive_buf == NULL) {
+		return -ENOTSUP;
+	}
+
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+
+	if (pipe->state == MODEM_PIPE_STATE_CLOSED) {
+		k_mutex_unlock(&pipe->lock);
+
+		return -EPERM;
+	}
+
+	ret = pipe->api->receive_buf(pipe->data, buf);
+
+	k_mutex_unlock(&pipe->lock);
+
+	return ret;
+}
+
 void modem_pipe_release(struct modem_pipe *pipe)
 {
 	k_mutex_lock(&pipe->lock, K_FOREVER);
@@ -193,6 +216,28 @@ void modem_pipe_notify_closed(struct modem_pipe *pipe)
 	k_mutex_unlock(&pipe->lock);
 }
 
+void modem_pipe_notify_signals_changed(struct modem_pipe *pipe)
+{
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+
+	if (pipe->callback != NULL) {
+		pipe->callback(pipe, MODEM_PIPE_EVENT_SIGNALS_CHANGED, pipe->user_data);
+	}
+
+	k_mutex_unlock(&pipe->lock);
+}
+
+void modem_pipe_notify_line_error(struct modem_pipe *pipe)
+{
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+
+	if (pipe->callback != NULL) {
+		pipe->callback(pipe, MODEM_PIPE_EVENT_LINE_ERROR, pipe->user_data);
+	}
+
+	k_mutex_unlock(&pipe->lock);
+}
+
 void modem_pipe_notify_receive_ready(struct modem_pipe *pipe)
 {
 	k_mutex_lock(&pipe->lock, K_FOREVER);
@@ -456,8 +456,28 @@ static void modem_ppp_process_handler(struct k_work *item)
 {
 	struct modem_ppp_work_item *ppp_work_item = (struct modem_ppp_work_item *)item;
 	struct modem_ppp *ppp = ppp_work_item->ppp;
+	struct net_buf *buf;
 	int ret;
 
+	/* Process received data in place if pipe delivers it in network buffers */
+	ret = modem_pipe_receive_buf(ppp->pipe, &buf);
+
+	if (ret == 0) {
+		for (uint16_t i = 0; i < buf->len; i++) {
+			modem_ppp_process_received_byte(ppp, buf->data[i]);
+		}
+
+		net_buf_unref(buf);
+
+		k_work_submit(&ppp->process_work.work);
+
+		return;
+	}
+
+	if (ret != -ENOTSUP) {
+		return;
+	}
+
 	ret = modem_pipe_receive(ppp->pipe, ppp->receive_buf, ppp->buf_size);
 
 	if (ret < 1) {
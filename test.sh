@@ -2,7 +2,7 @@
 
 set -e # Fail immediately if any command exits with a non-zero status
 
-APPS=("modem_cmux" "modem_ppp" "modem_chat" "modem_backend_tty")
+APPS=("modem_cmux" "modem_cmux_fuzz" "modem_ppp" "modem_chat" "modem_backend_tty")
 BUILD_APPS=("modem_e2e")
 ZEPHYR_EXE="./build/zephyr/zephyr.exe"
 
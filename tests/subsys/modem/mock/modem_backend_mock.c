@@ -38,6 +38,11 @@ static int modem_backend_mock_transmit(void *data, const uint8_t *buf, size_t si
 	struct modem_backend_mock *mock = (struct modem_backend_mock *)data;
 	int ret;
 
+	if (mock->transmit_log_cnt < mock->transmit_log_size) {
+		mock->transmit_log[mock->transmit_log_cnt] = size;
+		mock->transmit_log_cnt++;
+	}
+
 	size = (mock->limit < size) ? mock->limit : size;
 
 	ret = ring_buf_put(&mock->tx_rb, buf, size);
@@ -97,6 +102,8 @@ struct modem_pipe *modem_backend_mock_init(struct modem_backend_mock *mock,
 	k_work_init(&mock->received_work_item.work, modem_backend_mock_received_handler);
 
 	mock->limit = config->limit;
+	mock->transmit_log = config->transmit_log;
+	mock->transmit_log_size = (config->transmit_log == NULL) ? 0 : config->transmit_log_size;
 
 	modem_pipe_init(&mock->pipe, mock, &modem_backend_mock_api);
 
@@ -114,6 +121,7 @@ void modem_backend_mock_reset(struct modem_backend_mock *mock)
 	ring_buf_reset(&mock->tx_rb);
 	mock->transaction = NULL;
 	mock->transaction_match_cnt = 0;
+	mock->transmit_log_cnt = 0;
 }
 
 int modem_backend_mock_get(struct modem_backend_mock *mock, uint8_t *buf, size_t size)
@@ -43,6 +43,11 @@ struct modem_backend_mock {
 
 	/* Max allowed read/write size */
 	size_t limit;
+
+	/* Sizes of data given to transmit calls, logged if set */
+	size_t *transmit_log;
+	size_t transmit_log_size;
+	size_t transmit_log_cnt;
 };
 
 struct modem_backend_mock_config {
@@ -51,6 +56,8 @@ struct modem_backend_mock_config {
 	uint8_t *tx_buf;
 	size_t tx_buf_size;
 	size_t limit;
+	size_t *transmit_log;
+	size_t transmit_log_size;
 };
 
 struct modem_pipe *modem_backend_mock_init(struct modem_backend_mock *mock,
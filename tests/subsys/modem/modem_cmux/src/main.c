@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 #include <string.h>
 
+#include <zephyr/net/buf.h>
 #include <zephyr/modem/cmux.h>
 #include <modem_backend_mock.h>
 
@@ -23,6 +24,32 @@
 #define EVENT_CMUX_DLCI1_CLOSED BIT(3)
 #define EVENT_CMUX_DLCI2_CLOSED BIT(4)
 #define EVENT_CMUX_DISCONNECTED BIT(5)
+#define EVENT_CMUX_DLCI2_SIGNALS BIT(6)
+#define EVENT_CMUX_DLCI3_OPEN	BIT(7)
+#define EVENT_CMUX_ADVANCED_DLCI1_OPEN BIT(8)
+#define EVENT_CMUX_DLCI4_OPEN	BIT(9)
+#define EVENT_CMUX_DLCI4_CLOSED BIT(10)
+#define EVENT_CMUX_DLCI4_RECEIVE_READY BIT(11)
+#define EVENT_CMUX_POWER_SAVE_ENTERED BIT(12)
+#define EVENT_CMUX_POWER_SAVE_EXITED BIT(13)
+#define EVENT_CMUX_POWER_SAVE_DLCI1_OPEN BIT(14)
+#define EVENT_CMUX_UNRESPONSIVE BIT(15)
+#define EVENT_CMUX_DLCI5_OPEN	BIT(16)
+#define EVENT_CMUX_DLCI5_CLOSED BIT(17)
+#define EVENT_CMUX_DLCI6_OPEN	BIT(18)
+#define EVENT_CMUX_DLCI6_CLOSED BIT(19)
+#define EVENT_CMUX_DLCI6_RECEIVE_READY BIT(20)
+#define EVENT_CMUX_RESPONDER_CONNECTED BIT(21)
+#define EVENT_CMUX_RESPONDER_DISCONNECTED BIT(22)
+#define EVENT_CMUX_RESPONDER_DLCI1_OPEN BIT(23)
+#define EVENT_CMUX_RESPONDER_DLCI1_CLOSED BIT(24)
+#define EVENT_CMUX_TIMERS_CONNECTED BIT(25)
+#define EVENT_CMUX_TIMERS_CONNECT_FAILED BIT(26)
+#define EVENT_CMUX_TIMERS_DLCI1_CLOSED BIT(27)
+#define EVENT_CMUX_DLCI7_OPEN	BIT(28)
+#define EVENT_CMUX_DLCI7_CLOSED BIT(29)
+#define EVENT_CMUX_DLCI7_RECEIVE_READY BIT(30)
+#define EVENT_CMUX_DLCIS_DONE	BIT(31)
 
 /*************************************************************************************************/
 /*                                          Instances                                            */
@@ -30,12 +57,20 @@
 static struct modem_cmux cmux;
 static uint8_t cmux_receive_buf[127];
 static uint8_t cmux_transmit_buf[149];
+static uint8_t cmux_transmit_stage_buf[64];
 static struct modem_cmux_dlci dlci1;
 static struct modem_cmux_dlci dlci2;
+static struct modem_cmux_dlci dlci3;
+static struct modem_cmux_dlci dlci4;
+static struct modem_cmux_dlci dlci5;
 static struct modem_pipe *dlci1_pipe;
 static struct modem_pipe *dlci2_pipe;
+static struct modem_pipe *dlci3_pipe;
+static struct modem_pipe *dlci4_pipe;
+static struct modem_pipe *dlci5_pipe;
 
 static struct k_event cmux_event;
+static K_SEM_DEFINE(dlci2_line_error_sem, 0, 1);
 
 static struct modem_backend_mock bus_mock;
 static uint8_t bus_mock_rx_buf[4096];
@@ -44,6 +79,179 @@ static struct modem_pipe *bus_mock_pipe;
 
 static uint8_t dlci1_receive_buf[127];
 static uint8_t dlci2_receive_buf[127];
+static uint8_t dlci1_transmit_buf[127];
+static uint8_t dlci2_transmit_buf[127];
+static uint8_t dlci3_receive_buf[127];
+static uint8_t dlci3_transmit_buf[127];
+static uint8_t dlci4_receive_buf[127];
+static uint8_t dlci4_transmit_buf[127];
+static uint8_t dlci5_receive_buf[127];
+static uint8_t dlci5_transmit_buf[127];
+static uint8_t dlci7_receive_buf[127];
+static uint8_t dlci7_transmit_buf[127];
+static uint8_t dlci8_receive_buf[127];
+static uint8_t dlci8_transmit_buf[127];
+
+K_MEM_SLAB_DEFINE_STATIC(dlci_buf_slab, 128, 2, 4);
+
+#define DLCI8_RECEIVE_BUF_COUNT (3)
+#define DLCI8_RECEIVE_BUF_SIZE	(8)
+
+NET_BUF_POOL_DEFINE(dlci8_receive_pool, DLCI8_RECEIVE_BUF_COUNT, DLCI8_RECEIVE_BUF_SIZE, 0, NULL);
+
+static struct modem_cmux cmux_advanced;
+static uint8_t cmux_advanced_receive_buf[127];
+static uint8_t cmux_advanced_transmit_buf[149];
+static struct modem_cmux_dlci cmux_advanced_dlci1;
+static struct modem_pipe *cmux_advanced_dlci1_pipe;
+static uint8_t cmux_advanced_dlci1_receive_buf[127];
+static uint8_t cmux_advanced_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_advanced_bus_mock;
+static uint8_t cmux_advanced_bus_mock_rx_buf[256];
+static uint8_t cmux_advanced_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_advanced_bus_mock_pipe;
+
+static struct modem_cmux cmux_power_save;
+static uint8_t cmux_power_save_receive_buf[127];
+static uint8_t cmux_power_save_transmit_buf[149];
+static struct modem_cmux_dlci cmux_power_save_dlci1;
+static struct modem_pipe *cmux_power_save_dlci1_pipe;
+static uint8_t cmux_power_save_dlci1_receive_buf[127];
+static uint8_t cmux_power_save_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_power_save_bus_mock;
+static uint8_t cmux_power_save_bus_mock_rx_buf[256];
+static uint8_t cmux_power_save_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_power_save_bus_mock_pipe;
+
+static struct modem_cmux cmux_keepalive;
+static uint8_t cmux_keepalive_receive_buf[127];
+static uint8_t cmux_keepalive_transmit_buf[149];
+
+static struct modem_backend_mock cmux_keepalive_bus_mock;
+static uint8_t cmux_keepalive_bus_mock_rx_buf[256];
+static uint8_t cmux_keepalive_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_keepalive_bus_mock_pipe;
+
+static struct modem_cmux cmux_responder;
+static uint8_t cmux_responder_receive_buf[127];
+static uint8_t cmux_responder_transmit_buf[149];
+static struct modem_cmux_dlci cmux_responder_dlci1;
+static struct modem_pipe *cmux_responder_dlci1_pipe;
+static uint8_t cmux_responder_dlci1_receive_buf[127];
+static uint8_t cmux_responder_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_responder_bus_mock;
+static uint8_t cmux_responder_bus_mock_rx_buf[256];
+static uint8_t cmux_responder_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_responder_bus_mock_pipe;
+
+static struct modem_cmux cmux_timers;
+static uint8_t cmux_timers_receive_buf[127];
+static uint8_t cmux_timers_transmit_buf[149];
+static struct modem_cmux_dlci cmux_timers_dlci1;
+static struct modem_pipe *cmux_timers_dlci1_pipe;
+static uint8_t cmux_timers_dlci1_receive_buf[127];
+static uint8_t cmux_timers_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_timers_bus_mock;
+static uint8_t cmux_timers_bus_mock_rx_buf[256];
+static uint8_t cmux_timers_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_timers_bus_mock_pipe;
+
+static const struct modem_cmux_dlci_config cmux_static_dlci_configs[] = {
+	{
+		.dlci_address = 1,
+	},
+	{
+		.dlci_address = 2,
+		.priority = 1,
+	},
+};
+
+MODEM_CMUX_DEFINE(cmux_static, NULL, NULL, cmux_static_dlci_configs, 127, 149, 127);
+
+static const struct modem_cmux_dlci_config cmux_invalid_dlci_configs[] = {
+	{
+		.dlci_address = 1,
+	},
+	{
+		.dlci_address = 3,
+	},
+};
+
+static struct modem_cmux cmux_invalid;
+static uint8_t cmux_invalid_receive_buf[127];
+static uint8_t cmux_invalid_transmit_buf[149];
+static struct modem_cmux_dlci cmux_invalid_dlcis[ARRAY_SIZE(cmux_invalid_dlci_configs)];
+static uint8_t cmux_invalid_dlci_bufs[ARRAY_SIZE(cmux_invalid_dlci_configs)][2][127];
+
+static const struct modem_cmux_config cmux_invalid_config = {
+	.receive_buf = cmux_invalid_receive_buf,
+	.receive_buf_size = sizeof(cmux_invalid_receive_buf),
+	.transmit_buf = cmux_invalid_transmit_buf,
+	.transmit_buf_size = sizeof(cmux_invalid_transmit_buf),
+};
+
+static struct modem_backend_mock cmux_static_bus_mock;
+static uint8_t cmux_static_bus_mock_rx_buf[256];
+static uint8_t cmux_static_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_static_bus_mock_pipe;
+
+static struct modem_cmux cmux_direct;
+static uint8_t cmux_direct_receive_buf[127];
+static uint8_t cmux_direct_transmit_buf[149];
+static struct modem_cmux_dlci cmux_direct_dlci1;
+static struct modem_pipe *cmux_direct_dlci1_pipe;
+static uint8_t cmux_direct_dlci1_receive_buf[127];
+static uint8_t cmux_direct_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_direct_bus_mock;
+static uint8_t cmux_direct_bus_mock_rx_buf[256];
+static uint8_t cmux_direct_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_direct_bus_mock_pipe;
+
+static struct modem_cmux cmux_segment;
+static uint8_t cmux_segment_receive_buf[127];
+static uint8_t cmux_segment_transmit_buf[149];
+static struct modem_cmux_dlci cmux_segment_dlci1;
+static struct modem_pipe *cmux_segment_dlci1_pipe;
+static uint8_t cmux_segment_dlci1_receive_buf[127];
+static uint8_t cmux_segment_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_segment_bus_mock;
+static uint8_t cmux_segment_bus_mock_rx_buf[256];
+static uint8_t cmux_segment_bus_mock_tx_buf[256];
+static struct modem_pipe *cmux_segment_bus_mock_pipe;
+
+static struct modem_cmux cmux_stage;
+static uint8_t cmux_stage_receive_buf[127];
+static uint8_t cmux_stage_transmit_buf[149];
+static uint8_t cmux_stage_transmit_stage_buf[64];
+static struct modem_cmux_dlci cmux_stage_dlci1;
+static struct modem_pipe *cmux_stage_dlci1_pipe;
+static uint8_t cmux_stage_dlci1_receive_buf[127];
+static uint8_t cmux_stage_dlci1_transmit_buf[127];
+
+static struct modem_backend_mock cmux_stage_bus_mock;
+static uint8_t cmux_stage_bus_mock_rx_buf[256];
+static uint8_t cmux_stage_bus_mock_tx_buf[256];
+static size_t cmux_stage_bus_mock_transmit_log[16];
+static struct modem_pipe *cmux_stage_bus_mock_pipe;
+
+static struct modem_cmux cmux_schedule;
+static uint8_t cmux_schedule_receive_buf[127];
+static uint8_t cmux_schedule_transmit_buf[149];
+static struct modem_cmux_dlci cmux_schedule_dlcis[3];
+static struct modem_pipe *cmux_schedule_dlci_pipes[3];
+static uint8_t cmux_schedule_dlci_receive_bufs[3][127];
+static uint8_t cmux_schedule_dlci_transmit_bufs[3][64];
+
+static struct modem_backend_mock cmux_schedule_bus_mock;
+static uint8_t cmux_schedule_bus_mock_rx_buf[256];
+static uint8_t cmux_schedule_bus_mock_tx_buf[1024];
+static struct modem_pipe *cmux_schedule_bus_mock_pipe;
 
 static uint8_t buffer1[4096];
 static uint8_t buffer2[4096];
@@ -84,11 +292,212 @@ static void test_modem_dlci2_pipe_callback(struct modem_pipe *pipe, enum modem_p
 
 		break;
 
+	case MODEM_PIPE_EVENT_SIGNALS_CHANGED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI2_SIGNALS);
+
+		break;
+
+	case MODEM_PIPE_EVENT_LINE_ERROR:
+		k_sem_give(&dlci2_line_error_sem);
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void test_modem_dlci3_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					   void *user_data)
+{
+	if (event == MODEM_PIPE_EVENT_OPENED) {
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI3_OPEN);
+	}
+}
+
+static void test_modem_dlci4_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					   void *user_data)
+{
+	switch (event) {
+	case MODEM_PIPE_EVENT_OPENED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI4_OPEN);
+
+		break;
+
+	case MODEM_PIPE_EVENT_CLOSED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI4_CLOSED);
+
+		break;
+
+	case MODEM_PIPE_EVENT_RECEIVE_READY:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI4_RECEIVE_READY);
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void test_modem_dlci6_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					   void *user_data)
+{
+	switch (event) {
+	case MODEM_PIPE_EVENT_OPENED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI6_OPEN);
+
+		break;
+
+	case MODEM_PIPE_EVENT_CLOSED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI6_CLOSED);
+
+		break;
+
+	case MODEM_PIPE_EVENT_RECEIVE_READY:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI6_RECEIVE_READY);
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void test_modem_dlci7_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					   void *user_data)
+{
+	switch (event) {
+	case MODEM_PIPE_EVENT_OPENED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI7_OPEN);
+
+		break;
+
+	case MODEM_PIPE_EVENT_CLOSED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI7_CLOSED);
+
+		break;
+
+	case MODEM_PIPE_EVENT_RECEIVE_READY:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI7_RECEIVE_READY);
+
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void test_modem_dlci5_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					   void *user_data)
+{
+	switch (event) {
+	case MODEM_PIPE_EVENT_OPENED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI5_OPEN);
+
+		break;
+
+	case MODEM_PIPE_EVENT_CLOSED:
+		k_event_post(&cmux_event, EVENT_CMUX_DLCI5_CLOSED);
+
+		break;
+
 	default:
 		break;
 	}
 }
 
+static void test_modem_cmux_power_save_callback(struct modem_cmux *cmux,
+						enum modem_cmux_event event, void *user_data)
+{
+	if (event == MODEM_CMUX_EVENT_POWER_SAVE_ENTERED) {
+		k_event_post(&cmux_event, EVENT_CMUX_POWER_SAVE_ENTERED);
+		return;
+	}
+
+	if (event == MODEM_CMUX_EVENT_POWER_SAVE_EXITED) {
+		k_event_post(&cmux_event, EVENT_CMUX_POWER_SAVE_EXITED);
+		return;
+	}
+}
+
+static void test_modem_cmux_keepalive_callback(struct modem_cmux *cmux,
+					       enum modem_cmux_event event, void *user_data)
+{
+	if (event == MODEM_CMUX_EVENT_UNRESPONSIVE) {
+		k_event_post(&cmux_event, EVENT_CMUX_UNRESPONSIVE);
+	}
+}
+
+static void test_modem_cmux_responder_callback(struct modem_cmux *cmux,
+					       enum modem_cmux_event event, void *user_data)
+{
+	if (event == MODEM_CMUX_EVENT_CONNECTED) {
+		k_event_post(&cmux_event, EVENT_CMUX_RESPONDER_CONNECTED);
+		return;
+	}
+
+	if (event == MODEM_CMUX_EVENT_DISCONNECTED) {
+		k_event_post(&cmux_event, EVENT_CMUX_RESPONDER_DISCONNECTED);
+		return;
+	}
+}
+
+static void test_modem_cmux_responder_dlci1_pipe_callback(struct modem_pipe *pipe,
+							  enum modem_pipe_event event,
+							  void *user_data)
+{
+	if (event == MODEM_PIPE_EVENT_OPENED) {
+		k_event_post(&cmux_event, EVENT_CMUX_RESPONDER_DLCI1_OPEN);
+		return;
+	}
+
+	if (event == MODEM_PIPE_EVENT_CLOSED) {
+		k_event_post(&cmux_event, EVENT_CMUX_RESPONDER_DLCI1_CLOSED);
+		return;
+	}
+}
+
+static void test_modem_cmux_timers_callback(struct modem_cmux *cmux, enum modem_cmux_event event,
+					    void *user_data)
+{
+	if (event == MODEM_CMUX_EVENT_CONNECTED) {
+		k_event_post(&cmux_event, EVENT_CMUX_TIMERS_CONNECTED);
+		return;
+	}
+
+	if (event == MODEM_CMUX_EVENT_CONNECT_FAILED) {
+		k_event_post(&cmux_event, EVENT_CMUX_TIMERS_CONNECT_FAILED);
+		return;
+	}
+}
+
+static void test_modem_cmux_timers_dlci1_pipe_callback(struct modem_pipe *pipe,
+						       enum modem_pipe_event event,
+						       void *user_data)
+{
+	if (event == MODEM_PIPE_EVENT_CLOSED) {
+		k_event_post(&cmux_event, EVENT_CMUX_TIMERS_DLCI1_CLOSED);
+	}
+}
+
+static void test_modem_cmux_power_save_dlci1_pipe_callback(struct modem_pipe *pipe,
+							   enum modem_pipe_event event,
+							   void *user_data)
+{
+	if (event == MODEM_PIPE_EVENT_OPENED) {
+		k_event_post(&cmux_event, EVENT_CMUX_POWER_SAVE_DLCI1_OPEN);
+	}
+}
+
+static void test_modem_cmux_advanced_dlci1_pipe_callback(struct modem_pipe *pipe,
+							 enum modem_pipe_event event,
+							 void *user_data)
+{
+	if (event == MODEM_PIPE_EVENT_OPENED) {
+		k_event_post(&cmux_event, EVENT_CMUX_ADVANCED_DLCI1_OPEN);
+	}
+}
+
 /*************************************************************************************************/
 /*                                         CMUX frames                                           */
 /*************************************************************************************************/
@@ -122,6 +531,63 @@ static uint8_t cmux_frame_control_msc_cmd[] = {0xF9, 0x01, 0xFF, 0x09, 0xE3,
 static uint8_t cmux_frame_control_msc_ack[] = {0xF9, 0x01, 0xFF, 0x09, 0xE1,
 					       0x05, 0x0B, 0x09, 0x8F, 0xF9};
 
+static uint8_t cmux_frame_control_msc_dlci2_fc_cmd[] = {0xF9, 0x01, 0xFF, 0x09, 0xE3,
+							0x05, 0x0B, 0x8B, 0x8F, 0xF9};
+
+/* Remote stops transmission on DLCI1, DLCI2 and DLCI3 */
+static uint8_t cmux_frame_control_msc_dlcis_fc_cmd[] = {
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x07, 0x8B, 0x8F, 0xF9,
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x0B, 0x8B, 0x8F, 0xF9,
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x0F, 0x8B, 0x8F, 0xF9};
+
+/* Remote resumes transmission on DLCI2, then DLCI1 */
+static uint8_t cmux_frame_control_msc_dlci2_dlci1_cmd[] = {
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x0B, 0x89, 0x8F, 0xF9,
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x07, 0x89, 0x8F, 0xF9};
+
+/* Remote resumes transmission on DLCI2, then DLCI3 */
+static uint8_t cmux_frame_control_msc_dlci2_dlci3_cmd[] = {
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x0B, 0x89, 0x8F, 0xF9,
+	0xF9, 0x01, 0xFF, 0x09, 0xE3, 0x05, 0x0F, 0x89, 0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_msc_dlci2_fc_ack[] = {0xF9, 0x01, 0xFF, 0x09, 0xE1,
+							0x05, 0x0B, 0x8B, 0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_msc_dlci2_fc_on_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0xE3,
+							   0x05, 0x0B, 0x0F, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_control_msc_dlci2_fc_off_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0xE3,
+							    0x05, 0x0B, 0x0D, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci2_overrun_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0x53,
+							    0x05, 0x0B, 0x03, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci2_overrun_remote_cmd[] = {0xF9, 0x01, 0xFF, 0x09, 0x53,
+								   0x05, 0x0B, 0x03, 0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci2_overrun_remote_ack[] = {0xF9, 0x01, 0xFF, 0x09, 0x51,
+								   0x05, 0x0B, 0x03, 0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci2_no_error_remote_cmd[] = {0xF9, 0x01, 0xFF, 0x09,
+								    0x53, 0x05, 0x0B, 0x00,
+								    0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci2_no_error_remote_ack[] = {0xF9, 0x01, 0xFF, 0x09,
+								    0x51, 0x05, 0x0B, 0x00,
+								    0x8F, 0xF9};
+
+static uint8_t cmux_frame_control_pn_dlci3_cmd[] = {0xF9, 0x03, 0xEF, 0x15, 0x83, 0x11,
+						    0x03, 0x00, 0x00, 0x21, 0x7F, 0x00,
+						    0x03, 0x02, 0xEE, 0xF9};
+
+static uint8_t cmux_frame_control_pn_dlci3_ack[] = {0xF9, 0x01, 0xEF, 0x15, 0x81, 0x11,
+						    0x03, 0x00, 0x00, 0x21, 0x40, 0x00,
+						    0x03, 0x02, 0x8F, 0xF9};
+
+static uint8_t cmux_frame_dlci3_sabm_cmd[] = {0xF9, 0x0F, 0x3F, 0x01, 0x9B, 0xF9};
+
+static uint8_t cmux_frame_dlci3_sabm_ack[] = {0xF9, 0x0F, 0x73, 0x01, 0x50, 0xF9};
+
 static uint8_t cmux_frame_control_fcon_cmd[] = {0xF9, 0x01, 0xFF, 0x05, 0xA3, 0x01, 0x86, 0xF9};
 
 static uint8_t cmux_frame_control_fcon_ack[] = {0xF9, 0x01, 0xFF, 0x05, 0xA1, 0x01, 0x86, 0xF9};
@@ -130,6 +596,181 @@ static uint8_t cmux_frame_control_fcoff_cmd[] = {0xF9, 0x01, 0xFF, 0x05, 0x63, 0
 
 static uint8_t cmux_frame_control_fcoff_ack[] = {0xF9, 0x01, 0xFF, 0x05, 0x61, 0x01, 0x86, 0xF9};
 
+static uint8_t cmux_frame_dlci4_sabm_cmd[] = {0xF9, 0x13, 0x3F, 0x01, 0x96, 0xF9};
+
+static uint8_t cmux_frame_dlci4_sabm_ack[] = {0xF9, 0x13, 0x73, 0x01, 0x5D, 0xF9};
+
+static uint8_t cmux_frame_dlci4_disc_cmd[] = {0xF9, 0x13, 0x53, 0x01, 0x77, 0xF9};
+
+static uint8_t cmux_frame_dlci4_ua_ack[] = {0xF9, 0x13, 0x73, 0x01, 0x5D, 0xF9};
+
+static uint8_t cmux_frame_dlci5_sabm_cmd[] = {0xF9, 0x17, 0x3F, 0x01, 0x54, 0xF9};
+
+static uint8_t cmux_frame_dlci5_sabm_ack[] = {0xF9, 0x17, 0x73, 0x01, 0x9F, 0xF9};
+
+static uint8_t cmux_frame_dlci5_disc_cmd[] = {0xF9, 0x17, 0x53, 0x01, 0xB5, 0xF9};
+
+static uint8_t cmux_frame_dlci5_ua_ack[] = {0xF9, 0x17, 0x73, 0x01, 0x9F, 0xF9};
+
+static uint8_t cmux_frame_dlci5_at_cr[] = {0xF9, 0x15, 0xEF, 0x07, 0x41, 0x54, 0x0D, 0x38, 0xF9};
+
+static uint8_t cmux_frame_dlci5_newline[] = {0xF9, 0x15, 0xEF, 0x03, 0x0A, 0x3F, 0xF9};
+
+static uint8_t cmux_frame_data_dlci5_at[] = {0x41, 0x54};
+
+static uint8_t cmux_frame_dlci6_sabm_cmd[] = {0xF9, 0x1B, 0x3F, 0x01, 0xD3, 0xF9};
+
+static uint8_t cmux_frame_dlci6_sabm_ack[] = {0xF9, 0x1B, 0x73, 0x01, 0x18, 0xF9};
+
+static uint8_t cmux_frame_dlci6_disc_cmd[] = {0xF9, 0x1B, 0x53, 0x01, 0x32, 0xF9};
+
+static uint8_t cmux_frame_dlci6_ua_ack[] = {0xF9, 0x1B, 0x73, 0x01, 0x18, 0xF9};
+
+static uint8_t cmux_frame_dlci6_at[] = {0xF9, 0x1B, 0xEF, 0x05, 0x41, 0x54, 0x3D, 0xF9};
+
+static uint8_t cmux_frame_data_dlci6_at[] = {0x41, 0x54};
+
+static uint8_t cmux_frame_dlci7_sabm_cmd[] = {0xF9, 0x1F, 0x3F, 0x01, 0x11, 0xF9};
+
+static uint8_t cmux_frame_dlci7_sabm_ack[] = {0xF9, 0x1F, 0x73, 0x01, 0xDA, 0xF9};
+
+static uint8_t cmux_frame_dlci7_disc_cmd[] = {0xF9, 0x1F, 0x53, 0x01, 0xF0, 0xF9};
+
+static uint8_t cmux_frame_dlci7_ua_ack[] = {0xF9, 0x1F, 0x73, 0x01, 0xDA, 0xF9};
+
+/* UI frames with FCS computed over header and data */
+static uint8_t cmux_frame_dlci7_ui_at[] = {0xF9, 0x1F, 0x03, 0x05, 0x41, 0x54, 0x7E, 0xF9};
+
+static uint8_t cmux_frame_dlci7_ui_ok[] = {0xF9, 0x1D, 0x03, 0x05, 0x4F, 0x4B, 0x4F, 0xF9};
+
+/* UI frame with FCS computed over header only */
+static uint8_t cmux_frame_dlci7_ui_at_bad_fcs[] = {0xF9, 0x1F, 0x03, 0x05, 0x41, 0x54, 0xB6,
+						   0xF9};
+
+static uint8_t cmux_frame_data_dlci7_at[] = {0x41, 0x54};
+
+static uint8_t cmux_frame_data_dlci7_ok[] = {0x4F, 0x4B};
+
+/*************************************************************************************************/
+/*                             DLCI8 network buffer CMUX frames                                  */
+/*************************************************************************************************/
+static uint8_t cmux_frame_dlci8_sabm_cmd[] = {0xF9, 0x23, 0x3F, 0x01, 0xC9, 0xF9};
+
+static uint8_t cmux_frame_dlci8_disc_cmd[] = {0xF9, 0x23, 0x53, 0x01, 0x28, 0xF9};
+
+static uint8_t cmux_frame_dlci8_ua_ack[] = {0xF9, 0x23, 0x73, 0x01, 0x02, 0xF9};
+
+static uint8_t cmux_frame_dlci8_at[] = {0xF9, 0x23, 0xEF, 0x05, 0x41, 0x54, 0x27, 0xF9};
+
+static uint8_t cmux_frame_dlci8_ok_cr[] = {0xF9, 0x23, 0xEF, 0x07, 0x4F, 0x4B, 0x0D, 0xC4, 0xF9};
+
+static uint8_t cmux_frame_data_dlci8_at[] = {0x41, 0x54};
+
+static uint8_t cmux_frame_data_dlci8_ok_cr[] = {0x4F, 0x4B, 0x0D};
+
+static uint8_t cmux_frame_dlci8_digits[] = {0xF9, 0x23, 0xEF, 0x21, 0x30, 0x31, 0x32, 0x33,
+					    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B,
+					    0x3C, 0x3D, 0x3E, 0x3F, 0x18, 0xF9};
+
+static uint8_t cmux_frame_data_dlci8_digits[] = {0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37,
+						 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F};
+
+static uint8_t cmux_frame_control_msc_dlci8_fc_on_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0xE3,
+							   0x05, 0x23, 0x0F, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_control_msc_dlci8_fc_off_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0xE3,
+							    0x05, 0x23, 0x0D, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_control_rls_dlci8_overrun_cmd[] = {0xF9, 0x03, 0xEF, 0x09, 0x53,
+							     0x05, 0x23, 0x03, 0xFB, 0xF9};
+
+static uint8_t cmux_frame_data_dlci5_cr[] = {0x0D};
+
+static uint8_t cmux_frame_data_dlci5_newline[] = {0x0A};
+
+static uint8_t cmux_frame_control_psc_cmd[] = {0xF9, 0x03, 0xEF, 0x05, 0x43, 0x01, 0xF2, 0xF9};
+
+static uint8_t cmux_frame_control_psc_ack[] = {0xF9, 0x01, 0xEF, 0x05, 0x41, 0x01, 0x93, 0xF9};
+
+static uint8_t cmux_frame_control_psc_remote_cmd[] = {0xF9, 0x01, 0xEF, 0x05, 0x43, 0x01, 0x93,
+						      0xF9};
+
+static uint8_t cmux_frame_control_test_cmd[] = {0xF9, 0x03, 0xEF, 0x0D, 0x23, 0x09, 0x01,
+						0x00, 0x00, 0x00, 0xFC, 0xF9};
+
+static uint8_t cmux_frame_control_test_ack[] = {0xF9, 0x01, 0xEF, 0x0D, 0x21, 0x09, 0x01,
+						0x00, 0x00, 0x00, 0x9D, 0xF9};
+
+static uint8_t cmux_frame_wake_up_flags[] = {0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9, 0xF9};
+
+/*************************************************************************************************/
+/*                                 Responder role CMUX frames                                    */
+/*************************************************************************************************/
+/* Frames transmitted by initiator on DLCI1 use C/R bit 0 */
+static uint8_t cmux_frame_dlci1_initiator_at[] = {0xF9, 0x05, 0xEF, 0x05, 0x41, 0x54, 0x51, 0xF9};
+
+static uint8_t cmux_frame_dlci1_responder_ok[] = {0xF9, 0x07, 0xEF, 0x05, 0x4F, 0x4B, 0x30, 0xF9};
+
+static uint8_t cmux_frame_data_dlci1_ok[] = {0x4F, 0x4B};
+
+/* MSC command with RTC, RTR and DV for DLCI1 transmitted by responder */
+static uint8_t cmux_frame_control_msc_dlci1_dv_responder_cmd[] = {0xF9, 0x01, 0xEF, 0x09, 0xE3,
+								  0x05, 0x07, 0x8D, 0x9A, 0xF9};
+
+static uint8_t cmux_frame_control_fcoff_responder_cmd[] = {0xF9, 0x01, 0xEF, 0x05, 0x63, 0x01,
+							   0x93, 0xF9};
+
+static uint8_t cmux_frame_control_fcoff_initiator_ack[] = {0xF9, 0x01, 0xEF, 0x05, 0x61, 0x01,
+							   0x93, 0xF9};
+
+/*************************************************************************************************/
+/*                                 DLCI4 error recovery mode frames                              */
+/*************************************************************************************************/
+/* I frame N(S) 0, N(R) 0 */
+static uint8_t cmux_frame_dlci4_i_at[] = {0xF9, 0x13, 0x00, 0x05, 0x41, 0x54, 0x41, 0xF9};
+
+static uint8_t cmux_frame_data_dlci4_i_at[] = {0x41, 0x54};
+
+/* RR N(R) 1 */
+static uint8_t cmux_frame_dlci4_rr_1[] = {0xF9, 0x11, 0x21, 0x01, 0xA7, 0xF9};
+
+/* I frame N(S) 0, N(R) 1 */
+static uint8_t cmux_frame_dlci4_i_ok_0[] = {0xF9, 0x11, 0x20, 0x05, 0x4F, 0x4B, 0x6A, 0xF9};
+
+/* I frame N(S) 2, N(R) 1 */
+static uint8_t cmux_frame_dlci4_i_ok_2[] = {0xF9, 0x11, 0x24, 0x05, 0x4F, 0x4B, 0x19, 0xF9};
+
+static uint8_t cmux_frame_data_dlci4_i_ok[] = {0x4F, 0x4B};
+
+/* REJ N(R) 1 */
+static uint8_t cmux_frame_dlci4_rej_1[] = {0xF9, 0x11, 0x29, 0x01, 0x4D, 0xF9};
+
+/*************************************************************************************************/
+/*                                  Advanced option CMUX frames                                  */
+/*************************************************************************************************/
+static uint8_t cmux_frame_advanced_control_sabm_cmd[] = {0x7E, 0x03, 0x3F, 0xFC, 0x7E};
+
+static uint8_t cmux_frame_advanced_control_sabm_ack[] = {0x7E, 0x03, 0x73, 0x85, 0x7E};
+
+static uint8_t cmux_frame_advanced_dlci1_sabm_cmd[] = {0x7E, 0x07, 0x3F, 0x89, 0x7E};
+
+static uint8_t cmux_frame_advanced_dlci1_sabm_ack[] = {0x7E, 0x07, 0x73, 0xF0, 0x7E};
+
+static uint8_t cmux_frame_advanced_dlci1_escaped[] = {0x7E, 0x07, 0xEF, 0x41, 0x7D, 0x5E, 0x7D,
+						      0x5D, 0x7D, 0x31, 0x42, 0x05, 0x7E};
+
+static uint8_t cmux_frame_advanced_dlci1_escaped_tx[] = {0x7E, 0x05, 0xEF, 0x41, 0x7D, 0x5E, 0x7D,
+							 0x5D, 0x7D, 0x31, 0x42, 0xDF, 0x7E};
+
+static uint8_t cmux_frame_data_advanced_dlci1_escaped[] = {0x41, 0x7E, 0x7D, 0x11, 0x42};
+
+static uint8_t cmux_frame_advanced_dlci1_corrupted[] = {0x7E, 0x07, 0xEE, 0x41, 0x54, 0x05, 0x7E};
+
+static uint8_t cmux_frame_advanced_dlci1_at_newline[] = {0x7E, 0x07, 0xEF, 0x0D, 0x0A, 0x05,
+							 0x7E};
+
+static uint8_t cmux_frame_data_advanced_dlci1_at_newline[] = {0x0D, 0x0A};
+
 /*************************************************************************************************/
 /*                                     DLCI2 AT CMUX frames                                      */
 /*************************************************************************************************/
@@ -154,10 +795,17 @@ static uint8_t cmux_frame_dlci1_at_at[] = {0xF9, 0x07, 0xEF, 0x05, 0x41, 0x54, 0
 
 static uint8_t cmux_frame_data_dlci1_at_at[] = {0x41, 0x54};
 
+static uint8_t cmux_frame_dlci1_at_at_tx[] = {0xF9, 0x05, 0xEF, 0x05, 0x41, 0x54, 0x51, 0xF9};
+
 static uint8_t cmux_frame_dlci1_at_newline[] = {0xF9, 0x07, 0xEF, 0x05, 0x0D, 0x0A, 0x30, 0xF9};
 
 static uint8_t cmux_frame_data_dlci1_at_newline[] = {0x0D, 0x0A};
 
+static uint8_t cmux_frame_dlci1_at_at_fcs_error[] = {0xF9, 0x07, 0xEF, 0x05, 0x41, 0x54, 0x31,
+						     0xF9};
+
+static uint8_t cmux_frame_dlci10_newline[] = {0xF9, 0x29, 0xEF, 0x03, 0x0A, 0xE7, 0xF9};
+
 /*************************************************************************************************/
 /*                                DLCI1 AT CMUX Desync frames                                    */
 /*************************************************************************************************/
@@ -230,6 +878,35 @@ const static struct modem_backend_mock_transaction transaction_dlci2_sabm = {
 	.put_size = sizeof(cmux_frame_dlci2_ua_ack)
 };
 
+const static struct modem_backend_mock_transaction transaction_dlci3_sabm = {
+	.get = cmux_frame_dlci3_sabm_cmd,
+	.get_size = sizeof(cmux_frame_dlci3_sabm_cmd),
+	.put = cmux_frame_dlci3_sabm_ack,
+	.put_size = sizeof(cmux_frame_dlci3_sabm_ack)
+};
+
+const static struct modem_backend_mock_transaction transaction_dlci8_sabm = {
+	.get = cmux_frame_dlci8_sabm_cmd,
+	.get_size = sizeof(cmux_frame_dlci8_sabm_cmd),
+	.put = cmux_frame_dlci8_ua_ack,
+	.put_size = sizeof(cmux_frame_dlci8_ua_ack)
+};
+
+const static struct modem_backend_mock_transaction transaction_dlci8_disc = {
+	.get = cmux_frame_dlci8_disc_cmd,
+	.get_size = sizeof(cmux_frame_dlci8_disc_cmd),
+	.put = cmux_frame_dlci8_ua_ack,
+	.put_size = sizeof(cmux_frame_dlci8_ua_ack)
+};
+
+/* Answer DLCI1 command late, after T1 expired and it was retransmitted */
+static void test_modem_cmux_dlci1_ua_late_handler(struct k_work *item)
+{
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_ua_ack, sizeof(cmux_frame_dlci1_ua_ack));
+}
+
+static K_WORK_DELAYABLE_DEFINE(dlci1_ua_late_work, test_modem_cmux_dlci1_ua_late_handler);
+
 static void test_modem_cmux_callback(struct modem_cmux *cmux, enum modem_cmux_event event,
 				     void *user_data)
 {
@@ -242,6 +919,11 @@ static void test_modem_cmux_callback(struct modem_cmux *cmux, enum modem_cmux_ev
 		k_event_post(&cmux_event, EVENT_CMUX_DISCONNECTED);
 		return;
 	}
+
+	if ((event == MODEM_CMUX_EVENT_DLCIS_OPENED) || (event == MODEM_CMUX_EVENT_DLCIS_CLOSED)) {
+		k_event_post(&cmux_event, EVENT_CMUX_DLCIS_DONE);
+		return;
+	}
 }
 
 static void *test_modem_cmux_setup(void)
@@ -252,15 +934,46 @@ static void *test_modem_cmux_setup(void)
 		.dlci_address = 1,
 		.receive_buf = dlci1_receive_buf,
 		.receive_buf_size = sizeof(dlci1_receive_buf),
+		.transmit_buf = dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(dlci1_transmit_buf),
 	};
 
 	struct modem_cmux_dlci_config dlci2_config = {
 		.dlci_address = 2,
 		.receive_buf = dlci2_receive_buf,
 		.receive_buf_size = sizeof(dlci2_receive_buf),
+		.transmit_buf = dlci2_transmit_buf,
+		.transmit_buf_size = sizeof(dlci2_transmit_buf),
 	};
 
-	k_event_init(&cmux_event);
+	struct modem_cmux_dlci_config dlci3_config = {
+		.dlci_address = 3,
+		.receive_buf = dlci3_receive_buf,
+		.receive_buf_size = sizeof(dlci3_receive_buf),
+		.transmit_buf = dlci3_transmit_buf,
+		.transmit_buf_size = sizeof(dlci3_transmit_buf),
+		.negotiate = true,
+	};
+
+	struct modem_cmux_dlci_config dlci4_config = {
+		.dlci_address = 4,
+		.receive_buf = dlci4_receive_buf,
+		.receive_buf_size = sizeof(dlci4_receive_buf),
+		.transmit_buf = dlci4_transmit_buf,
+		.transmit_buf_size = sizeof(dlci4_transmit_buf),
+		.error_recovery = true,
+	};
+
+	struct modem_cmux_dlci_config dlci5_config = {
+		.dlci_address = 5,
+		.receive_buf = dlci5_receive_buf,
+		.receive_buf_size = sizeof(dlci5_receive_buf),
+		.transmit_buf = dlci5_transmit_buf,
+		.transmit_buf_size = sizeof(dlci5_transmit_buf),
+		.coalesce_timeout_us = 50000,
+	};
+
+	k_event_init(&cmux_event);
 
 	struct modem_cmux_config cmux_config = {
 		.callback = test_modem_cmux_callback,
@@ -269,6 +982,8 @@ static void *test_modem_cmux_setup(void)
 		.receive_buf_size = sizeof(cmux_receive_buf),
 		.transmit_buf = cmux_transmit_buf,
 		.transmit_buf_size = ARRAY_SIZE(cmux_transmit_buf),
+		.transmit_stage_buf = cmux_transmit_stage_buf,
+		.transmit_stage_buf_size = sizeof(cmux_transmit_stage_buf),
 	};
 
 	modem_cmux_init(&cmux, &cmux_config);
@@ -277,6 +992,12 @@ static void *test_modem_cmux_setup(void)
 
 	dlci2_pipe = modem_cmux_dlci_init(&cmux, &dlci2, &dlci2_config);
 
+	dlci3_pipe = modem_cmux_dlci_init(&cmux, &dlci3, &dlci3_config);
+
+	dlci4_pipe = modem_cmux_dlci_init(&cmux, &dlci4, &dlci4_config);
+
+	dlci5_pipe = modem_cmux_dlci_init(&cmux, &dlci5, &dlci5_config);
+
 	const struct modem_backend_mock_config bus_mock_config = {
 		.rx_buf = bus_mock_rx_buf,
 		.rx_buf_size = sizeof(bus_mock_rx_buf),
@@ -304,6 +1025,9 @@ static void *test_modem_cmux_setup(void)
 	/* Open DLCI channels */
 	modem_pipe_attach(dlci1_pipe, test_modem_dlci1_pipe_callback, NULL);
 	modem_pipe_attach(dlci2_pipe, test_modem_dlci2_pipe_callback, NULL);
+	modem_pipe_attach(dlci3_pipe, test_modem_dlci3_pipe_callback, NULL);
+	modem_pipe_attach(dlci4_pipe, test_modem_dlci4_pipe_callback, NULL);
+	modem_pipe_attach(dlci5_pipe, test_modem_dlci5_pipe_callback, NULL);
 
 	__ASSERT_NO_MSG(modem_pipe_open_async(dlci1_pipe) == 0);
 
@@ -475,6 +1199,93 @@ ZTEST(modem_cmux, modem_cmux_resync)
 			    cmux_frame_data_dlci1_at_newline,
 			    sizeof(cmux_frame_data_dlci1_at_newline)) == 0,
 		     "Incorrect data received");
+
+	/* Resync flags are not sent again within resync interval */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_at_at_desync,
+			       sizeof(cmux_frame_dlci1_at_at_desync));
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Resync flags sent within resync interval");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_resync, sizeof(cmux_frame_resync));
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_at_at, sizeof(cmux_frame_dlci1_at_at));
+
+	k_msleep(10);
+
+	ret = modem_pipe_receive(dlci1_pipe, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at),
+		     "Incorrect number of bytes received");
+}
+
+ZTEST(modem_cmux, modem_cmux_statistics)
+{
+	struct modem_cmux_stats stats_before;
+	struct modem_cmux_stats stats;
+	struct modem_cmux_dlci_stats dlci1_stats_before;
+	struct modem_cmux_dlci_stats dlci1_stats;
+	int ret;
+
+	modem_cmux_get_stats(&cmux, &stats_before);
+	modem_cmux_dlci_get_stats(&dlci1, &dlci1_stats_before);
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_at_at, sizeof(cmux_frame_dlci1_at_at));
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_at_at_fcs_error,
+			       sizeof(cmux_frame_dlci1_at_at_fcs_error));
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci10_newline,
+			       sizeof(cmux_frame_dlci10_newline));
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_at_newline,
+			       sizeof(cmux_frame_dlci1_at_newline));
+
+	k_msleep(100);
+
+	ret = modem_pipe_receive(dlci1_pipe, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (sizeof(cmux_frame_data_dlci1_at_at) +
+			     sizeof(cmux_frame_data_dlci1_at_newline)),
+		     "Incorrect number of bytes received");
+
+	ret = modem_pipe_transmit(dlci1_pipe, cmux_frame_data_dlci1_at_at,
+				  sizeof(cmux_frame_data_dlci1_at_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Failed to transmit data");
+
+	k_msleep(100);
+
+	modem_cmux_get_stats(&cmux, &stats);
+	modem_cmux_dlci_get_stats(&dlci1, &dlci1_stats);
+
+	zassert_true(stats.rx_frames == (stats_before.rx_frames + 3), "Incorrect rx frames");
+	zassert_true(stats.tx_frames == (stats_before.tx_frames + 1), "Incorrect tx frames");
+	zassert_true(stats.fcs_errors == (stats_before.fcs_errors + 1), "Incorrect FCS errors");
+	zassert_true(stats.unknown_dlci_frames == (stats_before.unknown_dlci_frames + 1),
+		     "Incorrect unknown DLCI frames");
+	zassert_true(stats.receive_buf_max >= sizeof(cmux_frame_data_dlci1_at_at),
+		     "Incorrect receive buffer high-water mark");
+	zassert_true(stats.transmit_buf_max >= sizeof(cmux_frame_dlci1_at_at),
+		     "Incorrect transmit buffer high-water mark");
+
+	zassert_true(dlci1_stats.rx_frames == (dlci1_stats_before.rx_frames + 2),
+		     "Incorrect DLCI rx frames");
+	zassert_true(dlci1_stats.rx_bytes == (dlci1_stats_before.rx_bytes +
+					      sizeof(cmux_frame_data_dlci1_at_at) +
+					      sizeof(cmux_frame_data_dlci1_at_newline)),
+		     "Incorrect DLCI rx bytes");
+	zassert_true(dlci1_stats.tx_frames == (dlci1_stats_before.tx_frames + 1),
+		     "Incorrect DLCI tx frames");
+	zassert_true(dlci1_stats.tx_bytes == (dlci1_stats_before.tx_bytes +
+					      sizeof(cmux_frame_data_dlci1_at_at)),
+		     "Incorrect DLCI tx bytes");
+	zassert_true(dlci1_stats.receive_buf_max >= (sizeof(cmux_frame_data_dlci1_at_at) +
+						     sizeof(cmux_frame_data_dlci1_at_newline)),
+		     "Incorrect DLCI receive buffer high-water mark");
 }
 
 ZTEST(modem_cmux, modem_cmux_flow_control_dlci2)
@@ -555,6 +1366,2158 @@ ZTEST(modem_cmux, modem_cmux_msc_cmd_ack)
 		     "Incorrect MSC ACK received");
 }
 
+ZTEST(modem_cmux, modem_cmux_msc_flow_control_dlci2)
+{
+	int ret;
+	uint32_t events;
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_control_msc_dlci2_fc_cmd,
+			       sizeof(cmux_frame_control_msc_dlci2_fc_cmd));
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci2_fc_ack),
+		     "Incorrect number of bytes received");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci2_fc_ack,
+			    sizeof(cmux_frame_control_msc_dlci2_fc_ack)) == 0,
+		     "Incorrect MSC ACK received");
+
+	/* DLCI2 data is queued while DLCI1 data is transmitted */
+	ret = modem_pipe_transmit(dlci2_pipe, cmux_frame_data_dlci2_ppp_52,
+				  sizeof(cmux_frame_data_dlci2_ppp_52));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci2_ppp_52), "Failed to queue DLCI2 data");
+
+	ret = modem_pipe_transmit(dlci1_pipe, cmux_frame_data_dlci1_at_at,
+				  sizeof(cmux_frame_data_dlci1_at_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Failed to send DLCI1 data");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci1_at_at_tx), "Only DLCI1 frame expected");
+
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_at_at_tx,
+			    sizeof(cmux_frame_dlci1_at_at_tx)) == 0,
+		     "Incorrect DLCI1 frame transmitted");
+
+	/* Clearing FC and DV resumes DLCI2 and notifies signal change */
+	k_event_clear(&cmux_event, EVENT_CMUX_DLCI2_SIGNALS);
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_control_msc_cmd,
+			       sizeof(cmux_frame_control_msc_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI2_SIGNALS, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI2_SIGNALS), "Signals changed event not raised");
+
+	zassert_true(modem_cmux_dlci_get_remote_signals(&dlci2) == MODEM_CMUX_SIGNAL_RTR,
+		     "Incorrect remote signals");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (sizeof(cmux_frame_control_msc_ack) + sizeof(cmux_frame_dlci2_ppp_52)),
+		     "Incorrect number of bytes transmitted");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_ack,
+			    sizeof(cmux_frame_control_msc_ack)) == 0,
+		     "Incorrect MSC ACK received");
+
+	zassert_true(memcmp(&buffer1[sizeof(cmux_frame_control_msc_ack)], cmux_frame_dlci2_ppp_52,
+			    sizeof(cmux_frame_dlci2_ppp_52)) == 0,
+		     "Incorrect DLCI2 frame transmitted");
+}
+
+ZTEST(modem_cmux, modem_cmux_receive_flow_control_dlci2)
+{
+	uint32_t dropped;
+	int ret;
+
+	dropped = dlci2.receive_rb_dropped;
+
+	/* Fill DLCI2 receive buffer past high watermark */
+	for (uint8_t i = 0; i < 3; i++) {
+		modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_at_cgdcont,
+				       sizeof(cmux_frame_dlci2_at_cgdcont));
+	}
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci2_fc_on_cmd),
+		     "Expected MSC with FC set");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci2_fc_on_cmd,
+			    sizeof(cmux_frame_control_msc_dlci2_fc_on_cmd)) == 0,
+		     "Incorrect MSC command transmitted");
+
+	/* Overrun DLCI2 receive buffer, which is reported to remote */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_at_cgdcont,
+			       sizeof(cmux_frame_dlci2_at_cgdcont));
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_rls_dlci2_overrun_cmd),
+		     "Expected RLS with overrun");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_rls_dlci2_overrun_cmd,
+			    sizeof(cmux_frame_control_rls_dlci2_overrun_cmd)) == 0,
+		     "Incorrect RLS command transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_at_cgdcont,
+			       sizeof(cmux_frame_dlci2_at_cgdcont));
+
+	k_msleep(100);
+
+	zassert_true(dlci2.receive_rb_dropped ==
+		     (dropped + (sizeof(cmux_frame_data_dlci2_at_cgdcont) * 5) -
+		      sizeof(dlci2_receive_buf)),
+		     "Incorrect number of dropped bytes");
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "MSC and RLS must only be sent once");
+
+	/* Drain DLCI2 receive buffer */
+	ret = modem_pipe_receive(dlci2_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == sizeof(dlci2_receive_buf), "Incorrect number of bytes received");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci2_fc_off_cmd),
+		     "Expected MSC with FC cleared");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci2_fc_off_cmd,
+			    sizeof(cmux_frame_control_msc_dlci2_fc_off_cmd)) == 0,
+		     "Incorrect MSC command transmitted");
+}
+
+ZTEST(modem_cmux, modem_cmux_rls_dlci2)
+{
+	int ret;
+
+	k_sem_reset(&dlci2_line_error_sem);
+
+	/* Line status without error is acknowledged without raising event */
+	modem_backend_mock_put(&bus_mock, cmux_frame_control_rls_dlci2_no_error_remote_cmd,
+			       sizeof(cmux_frame_control_rls_dlci2_no_error_remote_cmd));
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_rls_dlci2_no_error_remote_ack),
+		     "Incorrect number of bytes transmitted");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_rls_dlci2_no_error_remote_ack,
+			    sizeof(cmux_frame_control_rls_dlci2_no_error_remote_ack)) == 0,
+		     "Incorrect RLS ACK transmitted");
+
+	zassert_true(k_sem_take(&dlci2_line_error_sem, K_NO_WAIT) < 0,
+		     "Line error event not expected");
+
+	/* Overrun reported by remote raises event and is cleared when read */
+	modem_backend_mock_put(&bus_mock, cmux_frame_control_rls_dlci2_overrun_remote_cmd,
+			       sizeof(cmux_frame_control_rls_dlci2_overrun_remote_cmd));
+
+	zassert_true(k_sem_take(&dlci2_line_error_sem, K_MSEC(100)) == 0,
+		     "Line error event not raised");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_rls_dlci2_overrun_remote_ack),
+		     "Incorrect number of bytes transmitted");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_rls_dlci2_overrun_remote_ack,
+			    sizeof(cmux_frame_control_rls_dlci2_overrun_remote_ack)) == 0,
+		     "Incorrect RLS ACK transmitted");
+
+	zassert_true(modem_cmux_dlci_get_remote_line_status(&dlci2) ==
+		     MODEM_CMUX_LINE_STATUS_OVERRUN, "Incorrect remote line status");
+
+	zassert_true(modem_cmux_dlci_get_remote_line_status(&dlci2) == 0,
+		     "Remote line status not cleared");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci3_pn_open)
+{
+	uint32_t events;
+	int received;
+	int ret;
+
+	zassert_true(modem_pipe_open_async(dlci3_pipe) == 0, "Failed to open DLCI3 pipe");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_pn_dlci3_cmd),
+		     "Expected PN command to be sent before SABM");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_pn_dlci3_cmd,
+			    sizeof(cmux_frame_control_pn_dlci3_cmd)) == 0,
+		     "Incorrect PN command transmitted");
+
+	/* PN command is retransmitted once T2 expires */
+	k_msleep(600);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_pn_dlci3_cmd),
+		     "Expected PN command to be retransmitted");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_pn_dlci3_cmd,
+			    sizeof(cmux_frame_control_pn_dlci3_cmd)) == 0,
+		     "Incorrect PN command retransmitted");
+
+	/* Remote accepts with smaller frame size */
+	modem_backend_mock_put(&bus_mock, cmux_frame_control_pn_dlci3_ack,
+			       sizeof(cmux_frame_control_pn_dlci3_ack));
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci3_sabm_cmd), "Expected SABM after PN response");
+
+	zassert_true(memcmp(buffer1, cmux_frame_dlci3_sabm_cmd,
+			    sizeof(cmux_frame_dlci3_sabm_cmd)) == 0,
+		     "Incorrect DLCI3 open cmd transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci3_sabm_ack,
+			       sizeof(cmux_frame_dlci3_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI3_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI3_OPEN), "DLCI3 not opened as expected");
+
+	/* Data is segmented into frames of negotiated size */
+	ret = modem_pipe_transmit(dlci3_pipe, buffer2, 100);
+
+	zassert_true(ret == 100, "Failed to send DLCI3 data");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	/* Frames are F9, address, control, length, data, FCS, F9 */
+	received = 0;
+
+	for (int i = 0; i < ret; i += 6 + buffer1[i + 3] / 2) {
+		zassert_true(buffer1[i + 1] == 0x0D, "Expected DLCI3 frame");
+
+		zassert_true((buffer1[i + 3] / 2) <= 64, "Frame exceeds negotiated size");
+
+		received += buffer1[i + 3] / 2;
+	}
+
+	zassert_true(buffer1[3] == 0x81, "First frame should carry 64 bytes");
+
+	zassert_true(received == 100, "Incorrect number of bytes transmitted");
+}
+
+ZTEST(modem_cmux, modem_cmux_advanced_option)
+{
+	uint32_t events;
+	int ret;
+
+	struct modem_cmux_config cmux_config = {
+		.callback = NULL,
+		.user_data = NULL,
+		.option = MODEM_CMUX_OPTION_ADVANCED,
+		.receive_buf = cmux_advanced_receive_buf,
+		.receive_buf_size = sizeof(cmux_advanced_receive_buf),
+		.transmit_buf = cmux_advanced_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_advanced_transmit_buf),
+	};
+
+	struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_advanced_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_advanced_dlci1_receive_buf),
+		.transmit_buf = cmux_advanced_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_advanced_dlci1_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_advanced_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_advanced_bus_mock_rx_buf),
+		.tx_buf = cmux_advanced_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_advanced_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_advanced, &cmux_config);
+
+	cmux_advanced_dlci1_pipe = modem_cmux_dlci_init(&cmux_advanced, &cmux_advanced_dlci1,
+							&dlci1_config);
+
+	cmux_advanced_bus_mock_pipe = modem_backend_mock_init(&cmux_advanced_bus_mock,
+							      &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_advanced_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_advanced, cmux_advanced_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	/* Connect and open DLCI1 using advanced option frames */
+	zassert_true(modem_cmux_connect_async(&cmux_advanced) == 0, "Failed to connect CMUX");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_advanced_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_advanced_control_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_advanced_control_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&cmux_advanced_bus_mock, cmux_frame_advanced_control_sabm_ack,
+			       sizeof(cmux_frame_advanced_control_sabm_ack));
+
+	k_msleep(10);
+
+	modem_pipe_attach(cmux_advanced_dlci1_pipe, test_modem_cmux_advanced_dlci1_pipe_callback,
+			  NULL);
+
+	zassert_true(modem_pipe_open_async(cmux_advanced_dlci1_pipe) == 0,
+		     "Failed to open DLCI1 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_advanced_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_advanced_dlci1_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_advanced_dlci1_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&cmux_advanced_bus_mock, cmux_frame_advanced_dlci1_sabm_ack,
+			       sizeof(cmux_frame_advanced_dlci1_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_ADVANCED_DLCI1_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_ADVANCED_DLCI1_OPEN), "DLCI1 not opened as expected");
+
+	/* Octets which collide with flag, control escape, XON and XOFF are escaped */
+	ret = modem_pipe_transmit(cmux_advanced_dlci1_pipe, cmux_frame_data_advanced_dlci1_escaped,
+				  sizeof(cmux_frame_data_advanced_dlci1_escaped));
+
+	zassert_true(ret == sizeof(cmux_frame_data_advanced_dlci1_escaped),
+		     "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_advanced_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_advanced_dlci1_escaped_tx),
+		     "Incorrect number of bytes transmitted");
+	zassert_true(memcmp(buffer1, cmux_frame_advanced_dlci1_escaped_tx, ret) == 0,
+		     "Incorrect escaped frame transmitted");
+
+	/* Corrupted frame is dropped without affecting the following frames */
+	modem_backend_mock_put(&cmux_advanced_bus_mock, cmux_frame_advanced_dlci1_escaped,
+			       sizeof(cmux_frame_advanced_dlci1_escaped));
+
+	modem_backend_mock_put(&cmux_advanced_bus_mock, cmux_frame_advanced_dlci1_corrupted,
+			       sizeof(cmux_frame_advanced_dlci1_corrupted));
+
+	modem_backend_mock_put(&cmux_advanced_bus_mock, cmux_frame_advanced_dlci1_at_newline,
+			       sizeof(cmux_frame_advanced_dlci1_at_newline));
+
+	k_msleep(100);
+
+	ret = modem_pipe_receive(cmux_advanced_dlci1_pipe, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (sizeof(cmux_frame_data_advanced_dlci1_escaped) +
+			     sizeof(cmux_frame_data_advanced_dlci1_at_newline)),
+		     "Incorrect number of bytes received");
+
+	zassert_true(memcmp(buffer1, cmux_frame_data_advanced_dlci1_escaped,
+			    sizeof(cmux_frame_data_advanced_dlci1_escaped)) == 0,
+		     "Incorrect data received");
+
+	zassert_true(memcmp(&buffer1[sizeof(cmux_frame_data_advanced_dlci1_escaped)],
+			    cmux_frame_data_advanced_dlci1_at_newline,
+			    sizeof(cmux_frame_data_advanced_dlci1_at_newline)) == 0,
+		     "Incorrect data received");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci4_error_recovery)
+{
+	uint32_t events;
+	int ret;
+
+	zassert_true(modem_pipe_open_async(dlci4_pipe) == 0, "Failed to open DLCI4 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_sabm_ack,
+			       sizeof(cmux_frame_dlci4_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI4_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI4_OPEN), "DLCI4 not opened as expected");
+
+	/* Data is transmitted in I frame */
+	ret = modem_pipe_transmit(dlci4_pipe, cmux_frame_data_dlci4_i_at,
+				  sizeof(cmux_frame_data_dlci4_i_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci4_i_at), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_i_at), "Incorrect I frame size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_i_at, ret) == 0,
+		     "Incorrect I frame transmitted");
+
+	/* Unacknowledged I frame is retransmitted when T1 expires */
+	k_msleep(400);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_i_at), "I frame not retransmitted");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_i_at, ret) == 0,
+		     "Incorrect I frame retransmitted");
+
+	/* Acknowledged I frame is not retransmitted */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_rr_1, sizeof(cmux_frame_dlci4_rr_1));
+
+	k_msleep(400);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Acknowledged I frame retransmitted");
+
+	/* Received I frame is delivered and acknowledged */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_i_ok_0,
+			       sizeof(cmux_frame_dlci4_i_ok_0));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI4_RECEIVE_READY, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI4_RECEIVE_READY), "I frame not received");
+
+	k_msleep(10);
+
+	ret = modem_pipe_receive(dlci4_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci4_i_ok), "Incorrect data size received");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci4_i_ok, ret) == 0,
+		     "Incorrect data received");
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_rr_1), "Incorrect RR size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_rr_1, ret) == 0, "Incorrect RR transmitted");
+
+	/* Out of sequence I frame is rejected and dropped */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_i_ok_2,
+			       sizeof(cmux_frame_dlci4_i_ok_2));
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_rej_1), "Incorrect REJ size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_rej_1, ret) == 0,
+		     "Incorrect REJ transmitted");
+
+	ret = modem_pipe_receive(dlci4_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == 0, "Out of sequence I frame received");
+
+	/* Close DLCI4 */
+	zassert_true(modem_pipe_close_async(dlci4_pipe) == 0, "Failed to close DLCI4 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_disc_cmd), "Incorrect DISC size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_disc_cmd, ret) == 0,
+		     "Incorrect DISC transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_ua_ack, sizeof(cmux_frame_dlci4_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI4_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI4_CLOSED), "DLCI4 not closed as expected");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci4_retransmit_limit)
+{
+	uint32_t events;
+	uint8_t retransmissions = 0;
+	int ret;
+
+	zassert_true(modem_pipe_open_async(dlci4_pipe) == 0, "Failed to open DLCI4 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_sabm_cmd), "Incorrect SABM size");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_sabm_ack,
+			       sizeof(cmux_frame_dlci4_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI4_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI4_OPEN), "DLCI4 not opened as expected");
+
+	ret = modem_pipe_transmit(dlci4_pipe, cmux_frame_data_dlci4_i_at,
+				  sizeof(cmux_frame_data_dlci4_i_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci4_i_at), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_i_at), "Incorrect I frame size");
+
+	/* I frame is retransmitted N2 times without RR from remote, then DLCI is closed */
+	while (true) {
+		k_msleep(400);
+
+		ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+		if ((ret != sizeof(cmux_frame_dlci4_i_at)) ||
+		    (memcmp(buffer1, cmux_frame_dlci4_i_at, ret) != 0)) {
+			break;
+		}
+
+		retransmissions++;
+
+		zassert_true(retransmissions <= 3, "I frame retransmitted more than N2 times");
+	}
+
+	zassert_true(retransmissions == 3, "I frame not retransmitted N2 times");
+
+	zassert_true(ret == sizeof(cmux_frame_dlci4_disc_cmd), "Incorrect DISC size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci4_disc_cmd, ret) == 0,
+		     "Incorrect DISC transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci4_ua_ack, sizeof(cmux_frame_dlci4_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI4_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI4_CLOSED), "DLCI4 not closed as expected");
+
+	k_msleep(1000);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Data transmitted after DLCI4 closed");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci5_coalescing)
+{
+	uint32_t events;
+	int ret;
+
+	zassert_true(modem_pipe_open_async(dlci5_pipe) == 0, "Failed to open DLCI5 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci5_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci5_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci5_sabm_ack,
+			       sizeof(cmux_frame_dlci5_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI5_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI5_OPEN), "DLCI5 not opened as expected");
+
+	/* Small writes are held back until the coalescing window elapses */
+	ret = modem_pipe_transmit(dlci5_pipe, cmux_frame_data_dlci5_at, sizeof(cmux_frame_data_dlci5_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci5_at), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Data transmitted before coalescing window elapsed");
+
+	ret = modem_pipe_transmit(dlci5_pipe, cmux_frame_data_dlci5_cr, sizeof(cmux_frame_data_dlci5_cr));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci5_cr), "Failed to transmit data");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci5_at_cr), "Writes not coalesced");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci5_at_cr, ret) == 0,
+		     "Incorrect coalesced frame transmitted");
+
+	/* Flushed data is transmitted without waiting */
+	ret = modem_pipe_transmit(dlci5_pipe, cmux_frame_data_dlci5_newline,
+				  sizeof(cmux_frame_data_dlci5_newline));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci5_newline), "Failed to transmit data");
+
+	modem_cmux_dlci_flush(&dlci5);
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci5_newline), "Flushed data not transmitted");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci5_newline, ret) == 0,
+		     "Incorrect flushed frame transmitted");
+
+	/* Close DLCI5 */
+	zassert_true(modem_pipe_close_async(dlci5_pipe) == 0, "Failed to close DLCI5 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci5_disc_cmd), "Incorrect DISC size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci5_disc_cmd, ret) == 0,
+		     "Incorrect DISC transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci5_ua_ack, sizeof(cmux_frame_dlci5_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI5_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI5_CLOSED), "DLCI5 not closed as expected");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci6_runtime)
+{
+	struct modem_cmux_dlci dlci6;
+	struct modem_pipe *dlci6_pipe;
+	uint32_t events;
+	int ret;
+
+	const struct modem_cmux_dlci_config dlci6_config = {
+		.dlci_address = 6,
+		.receive_buf_size = 127,
+		.transmit_buf_size = 127,
+		.buf_slab = &dlci_buf_slab,
+	};
+
+	/* DLCI is created at runtime and allocates buffers only while open */
+	dlci6_pipe = modem_cmux_dlci_init(&cmux, &dlci6, &dlci6_config);
+
+	modem_pipe_attach(dlci6_pipe, test_modem_dlci6_pipe_callback, NULL);
+
+	zassert_true(k_mem_slab_num_used_get(&dlci_buf_slab) == 0, "Buffers allocated before open");
+
+	zassert_true(modem_pipe_open_async(dlci6_pipe) == 0, "Failed to open DLCI6 pipe");
+
+	zassert_true(k_mem_slab_num_used_get(&dlci_buf_slab) == 2, "Buffers not allocated");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci6_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci6_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci6_sabm_ack,
+			       sizeof(cmux_frame_dlci6_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI6_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI6_OPEN), "DLCI6 not opened as expected");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci6_at, sizeof(cmux_frame_dlci6_at));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI6_RECEIVE_READY, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI6_RECEIVE_READY), "Data not received");
+
+	ret = modem_pipe_receive(dlci6_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci6_at), "Incorrect data size received");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci6_at, ret) == 0,
+		     "Incorrect data received");
+
+	/* Removing open DLCI is rejected */
+	zassert_true(modem_cmux_dlci_deinit(&dlci6) == -EBUSY, "Open DLCI removed");
+
+	zassert_true(modem_pipe_close_async(dlci6_pipe) == 0, "Failed to close DLCI6 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci6_disc_cmd), "Incorrect DISC size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci6_disc_cmd, ret) == 0,
+		     "Incorrect DISC transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci6_ua_ack, sizeof(cmux_frame_dlci6_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI6_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI6_CLOSED), "DLCI6 not closed as expected");
+
+	zassert_true(k_mem_slab_num_used_get(&dlci_buf_slab) == 0, "Buffers not freed");
+
+	zassert_true(modem_cmux_dlci_deinit(&dlci6) == 0, "Failed to remove DLCI6");
+
+	/* Frames for removed DLCI are ignored */
+	k_event_clear(&cmux_event, EVENT_CMUX_DLCI6_RECEIVE_READY);
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci6_at, sizeof(cmux_frame_dlci6_at));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI6_RECEIVE_READY, false, K_MSEC(10));
+
+	zassert_true(events == 0, "Frame delivered to removed DLCI");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci7_ui_frames)
+{
+	struct modem_cmux_dlci dlci7;
+	struct modem_pipe *dlci7_pipe;
+	uint32_t events;
+	int ret;
+
+	const struct modem_cmux_dlci_config dlci7_config = {
+		.dlci_address = 7,
+		.receive_buf = dlci7_receive_buf,
+		.receive_buf_size = sizeof(dlci7_receive_buf),
+		.transmit_buf = dlci7_transmit_buf,
+		.transmit_buf_size = sizeof(dlci7_transmit_buf),
+		.ui_frames = true,
+	};
+
+	dlci7_pipe = modem_cmux_dlci_init(&cmux, &dlci7, &dlci7_config);
+
+	modem_pipe_attach(dlci7_pipe, test_modem_dlci7_pipe_callback, NULL);
+
+	zassert_true(modem_pipe_open_async(dlci7_pipe) == 0, "Failed to open DLCI7 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci7_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci7_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci7_sabm_ack,
+			       sizeof(cmux_frame_dlci7_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI7_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI7_OPEN), "DLCI7 not opened as expected");
+
+	/* UI frame is received if FCS over data is valid */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci7_ui_at_bad_fcs,
+			       sizeof(cmux_frame_dlci7_ui_at_bad_fcs));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI7_RECEIVE_READY, false, K_MSEC(10));
+
+	zassert_true(events == 0, "UI frame with invalid FCS received");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci7_ui_at, sizeof(cmux_frame_dlci7_ui_at));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI7_RECEIVE_READY, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI7_RECEIVE_READY), "Data not received");
+
+	ret = modem_pipe_receive(dlci7_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci7_at), "Incorrect data size received");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci7_at, ret) == 0,
+		     "Incorrect data received");
+
+	/* Data is transmitted in UI frames */
+	ret = modem_pipe_transmit(dlci7_pipe, cmux_frame_data_dlci7_ok,
+				  sizeof(cmux_frame_data_dlci7_ok));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci7_ok), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci7_ui_ok), "Incorrect UI frame size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci7_ui_ok, ret) == 0,
+		     "Incorrect UI frame transmitted");
+
+	zassert_true(modem_pipe_close_async(dlci7_pipe) == 0, "Failed to close DLCI7 pipe");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci7_disc_cmd), "Incorrect DISC size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci7_disc_cmd, ret) == 0,
+		     "Incorrect DISC transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci7_ua_ack, sizeof(cmux_frame_dlci7_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI7_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI7_CLOSED), "DLCI7 not closed as expected");
+
+	zassert_true(modem_cmux_dlci_deinit(&dlci7) == 0, "Failed to remove DLCI7");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlci8_receive_bufs)
+{
+	struct modem_cmux_dlci dlci8;
+	struct modem_pipe *dlci8_pipe;
+	struct modem_cmux_dlci_stats stats;
+	struct net_buf *bufs[DLCI8_RECEIVE_BUF_COUNT];
+	struct net_buf *buf;
+	int ret;
+
+	const struct modem_cmux_dlci_config dlci8_config = {
+		.dlci_address = 8,
+		.receive_buf = dlci8_receive_buf,
+		.receive_buf_size = sizeof(dlci8_receive_buf),
+		.transmit_buf = dlci8_transmit_buf,
+		.transmit_buf_size = sizeof(dlci8_transmit_buf),
+		.receive_buf_pool = &dlci8_receive_pool,
+	};
+
+	/* Pipes without network buffer pool deliver data through receive buffer only */
+	zassert_true(modem_pipe_receive_buf(dlci1_pipe, &buf) == -ENOTSUP,
+		     "DLCI1 should not deliver network buffers");
+
+	dlci8_pipe = modem_cmux_dlci_init(&cmux, &dlci8, &dlci8_config);
+
+	modem_backend_mock_prime(&bus_mock, &transaction_dlci8_sabm);
+
+	zassert_true(modem_pipe_open(dlci8_pipe) == 0, "Failed to open DLCI8 pipe");
+
+	modem_backend_mock_reset(&bus_mock);
+
+	/* Data of small frames is packed into the same buffer */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_at, sizeof(cmux_frame_dlci8_at));
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_ok_cr, sizeof(cmux_frame_dlci8_ok_cr));
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_at, sizeof(cmux_frame_dlci8_at));
+
+	k_msleep(100);
+
+	modem_cmux_dlci_get_stats(&dlci8, &stats);
+
+	zassert_true(stats.rx_dropped == 0, "No data should be dropped");
+
+	ret = modem_pipe_receive_buf(dlci8_pipe, &buf);
+
+	zassert_true(ret == 0, "Failed to receive buffer");
+	zassert_true(buf->len == ((sizeof(cmux_frame_data_dlci8_at) * 2) +
+				  sizeof(cmux_frame_data_dlci8_ok_cr)),
+		     "Incorrect buffer length");
+	zassert_true(memcmp(buf->data, cmux_frame_data_dlci8_at,
+			    sizeof(cmux_frame_data_dlci8_at)) == 0,
+		     "Incorrect buffer data");
+	zassert_true(memcmp(&buf->data[sizeof(cmux_frame_data_dlci8_at)],
+			    cmux_frame_data_dlci8_ok_cr, sizeof(cmux_frame_data_dlci8_ok_cr)) == 0,
+		     "Incorrect buffer data");
+
+	net_buf_unref(buf);
+
+	zassert_true(modem_pipe_receive_buf(dlci8_pipe, &buf) == -EAGAIN,
+		     "No buffer should be queued");
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Flow control should not be asserted");
+
+	/* Frame larger than a buffer spans buffers, leaving one in pool asserts flow control */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_digits,
+			       sizeof(cmux_frame_dlci8_digits));
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci8_fc_on_cmd),
+		     "Expected MSC with FC set");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci8_fc_on_cmd,
+			    sizeof(cmux_frame_control_msc_dlci8_fc_on_cmd)) == 0,
+		     "Incorrect MSC command transmitted");
+
+	/* Data not fitting in pool is dropped */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_at, sizeof(cmux_frame_dlci8_at));
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_digits,
+			       sizeof(cmux_frame_dlci8_digits));
+
+	k_msleep(100);
+
+	modem_cmux_dlci_get_stats(&dlci8, &stats);
+
+	zassert_true(stats.rx_dropped ==
+		     (sizeof(cmux_frame_data_dlci8_digits) -
+		      (DLCI8_RECEIVE_BUF_SIZE - sizeof(cmux_frame_data_dlci8_at))),
+		     "Data should be dropped with no buffer available");
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_rls_dlci8_overrun_cmd),
+		     "Expected RLS with overrun");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_rls_dlci8_overrun_cmd,
+			    sizeof(cmux_frame_control_rls_dlci8_overrun_cmd)) == 0,
+		     "Incorrect RLS command transmitted");
+
+	/* Queued buffers can still be read through the pipe */
+	ret = modem_pipe_receive(dlci8_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == (DLCI8_RECEIVE_BUF_SIZE * DLCI8_RECEIVE_BUF_COUNT),
+		     "Incorrect data size received");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci8_digits,
+			    sizeof(cmux_frame_data_dlci8_digits)) == 0,
+		     "Incorrect data received");
+	zassert_true(memcmp(&buffer2[sizeof(cmux_frame_data_dlci8_digits)],
+			    cmux_frame_data_dlci8_at, sizeof(cmux_frame_data_dlci8_at)) == 0,
+		     "Incorrect data received");
+	zassert_true(memcmp(&buffer2[sizeof(cmux_frame_data_dlci8_digits) +
+				     sizeof(cmux_frame_data_dlci8_at)],
+			    cmux_frame_data_dlci8_digits,
+			    DLCI8_RECEIVE_BUF_SIZE - sizeof(cmux_frame_data_dlci8_at)) == 0,
+		     "Incorrect data received");
+
+	zassert_true(modem_pipe_receive_buf(dlci8_pipe, &buf) == -EAGAIN,
+		     "No buffer should be queued");
+
+	/* Emptied buffers are returned to pool, allowing remote to resume transmitting */
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci8_fc_off_cmd),
+		     "Expected MSC with FC cleared");
+
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci8_fc_off_cmd,
+			    sizeof(cmux_frame_control_msc_dlci8_fc_off_cmd)) == 0,
+		     "Incorrect MSC command transmitted");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci8_ok_cr, sizeof(cmux_frame_dlci8_ok_cr));
+
+	k_msleep(100);
+
+	/* Buffers still queued are released when closed */
+	modem_backend_mock_prime(&bus_mock, &transaction_dlci8_disc);
+
+	zassert_true(modem_pipe_close(dlci8_pipe) == 0, "Failed to close DLCI8 pipe");
+
+	zassert_true(modem_cmux_dlci_deinit(&dlci8) == 0, "Failed to remove DLCI8");
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = net_buf_alloc(&dlci8_receive_pool, K_NO_WAIT);
+
+		zassert_not_null(bufs[i], "Buffers not released when DLCI closed");
+	}
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(bufs); i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
+ZTEST(modem_cmux, modem_cmux_responder)
+{
+	uint32_t events;
+	int ret;
+
+	struct modem_cmux_config cmux_config = {
+		.callback = test_modem_cmux_responder_callback,
+		.user_data = NULL,
+		.receive_buf = cmux_responder_receive_buf,
+		.receive_buf_size = sizeof(cmux_responder_receive_buf),
+		.transmit_buf = cmux_responder_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_responder_transmit_buf),
+		.role = MODEM_CMUX_ROLE_RESPONDER,
+	};
+
+	const struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_responder_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_responder_dlci1_receive_buf),
+		.transmit_buf = cmux_responder_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_responder_dlci1_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_responder_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_responder_bus_mock_rx_buf),
+		.tx_buf = cmux_responder_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_responder_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_responder, &cmux_config);
+
+	cmux_responder_dlci1_pipe = modem_cmux_dlci_init(&cmux_responder, &cmux_responder_dlci1,
+							 &dlci1_config);
+
+	modem_pipe_attach(cmux_responder_dlci1_pipe,
+			  test_modem_cmux_responder_dlci1_pipe_callback, NULL);
+
+	cmux_responder_bus_mock_pipe = modem_backend_mock_init(&cmux_responder_bus_mock,
+							       &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_responder_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_responder, cmux_responder_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	k_event_clear(&cmux_event, EVENT_CMUX_RESPONDER_CONNECTED |
+				   EVENT_CMUX_RESPONDER_DISCONNECTED |
+				   EVENT_CMUX_RESPONDER_DLCI1_OPEN |
+				   EVENT_CMUX_RESPONDER_DLCI1_CLOSED);
+
+	/* Responder listens for SABM frame rather than transmitting it */
+	zassert_true(modem_cmux_connect_async(&cmux_responder) == 0, "Failed to connect CMUX");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == 0, "Responder transmitted before SABM was received");
+
+	/* Response frames from responder use C/R bit 1 */
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_control_sabm_cmd,
+			       sizeof(cmux_frame_control_sabm_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_RESPONDER_CONNECTED, false, K_MSEC(100));
+	zassert_true((events & EVENT_CMUX_RESPONDER_CONNECTED), "CMUX not connected");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_control_sabm_ack), "Incorrect UA size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_sabm_ack, ret) == 0,
+		     "Incorrect UA transmitted");
+
+	/* DLCI is opened by initiator */
+	zassert_true(modem_pipe_open_async(cmux_responder_dlci1_pipe) == 0,
+		     "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_dlci1_sabm_cmd,
+			       sizeof(cmux_frame_dlci1_sabm_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_RESPONDER_DLCI1_OPEN, false, K_MSEC(100));
+	zassert_true((events & EVENT_CMUX_RESPONDER_DLCI1_OPEN), "DLCI1 not opened");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_sabm_ack), "Incorrect UA size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_sabm_ack, ret) == 0,
+		     "Incorrect UA transmitted");
+
+	/* Data is exchanged with C/R bit inverted relative to initiator */
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_dlci1_initiator_at,
+			       sizeof(cmux_frame_dlci1_initiator_at));
+
+	k_msleep(10);
+
+	ret = modem_pipe_receive(cmux_responder_dlci1_pipe, buffer2, sizeof(buffer2));
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Incorrect data size");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci1_at_at, ret) == 0,
+		     "Incorrect data received");
+
+	ret = modem_pipe_transmit(cmux_responder_dlci1_pipe, cmux_frame_data_dlci1_ok,
+				  sizeof(cmux_frame_data_dlci1_ok));
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_ok), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_responder_ok), "Incorrect data frame size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_responder_ok, ret) == 0,
+		     "Incorrect data frame transmitted");
+
+	/* V.24 signals and flow control are generated with MSC and FCOFF commands */
+	ret = modem_cmux_dlci_set_signals(&cmux_responder_dlci1, MODEM_CMUX_SIGNAL_RTC |
+					  MODEM_CMUX_SIGNAL_RTR | MODEM_CMUX_SIGNAL_DV);
+	zassert_true(ret == 0, "Failed to set signals");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_control_msc_dlci1_dv_responder_cmd),
+		     "Incorrect MSC size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_msc_dlci1_dv_responder_cmd, ret) == 0,
+		     "Incorrect MSC transmitted");
+
+	zassert_true(modem_cmux_set_flow_control(&cmux_responder, false) == 0,
+		     "Failed to set flow control");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_control_fcoff_responder_cmd), "Incorrect FCOFF size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_fcoff_responder_cmd, ret) == 0,
+		     "Incorrect FCOFF transmitted");
+
+	/* FCOFF response does not stop transmission of responder */
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_control_fcoff_initiator_ack,
+			       sizeof(cmux_frame_control_fcoff_initiator_ack));
+
+	k_msleep(10);
+
+	ret = modem_pipe_transmit(cmux_responder_dlci1_pipe, cmux_frame_data_dlci1_ok,
+				  sizeof(cmux_frame_data_dlci1_ok));
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_ok), "Failed to transmit data");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_responder_ok), "Incorrect data frame size");
+
+	/* DLCI is closed by initiator */
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_dlci1_disc_cmd,
+			       sizeof(cmux_frame_dlci1_disc_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_RESPONDER_DLCI1_CLOSED, false, K_MSEC(100));
+	zassert_true((events & EVENT_CMUX_RESPONDER_DLCI1_CLOSED), "DLCI1 not closed");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_ua_ack), "Incorrect UA size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_ua_ack, ret) == 0,
+		     "Incorrect UA transmitted");
+
+	/* Close down command is acknowledged */
+	modem_backend_mock_put(&cmux_responder_bus_mock, cmux_frame_control_cld_cmd,
+			       sizeof(cmux_frame_control_cld_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_RESPONDER_DISCONNECTED, false, K_MSEC(100));
+	zassert_true((events & EVENT_CMUX_RESPONDER_DISCONNECTED), "CMUX not disconnected");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_responder_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_control_cld_ack), "Incorrect CLD size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_cld_ack, ret) == 0,
+		     "Incorrect CLD transmitted");
+}
+
+ZTEST(modem_cmux, modem_cmux_timers)
+{
+	uint32_t events;
+	int ret;
+
+	struct modem_cmux_config cmux_config = {
+		.callback = test_modem_cmux_timers_callback,
+		.user_data = NULL,
+		.receive_buf = cmux_timers_receive_buf,
+		.receive_buf_size = sizeof(cmux_timers_receive_buf),
+		.transmit_buf = cmux_timers_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_timers_transmit_buf),
+		.t1_timeout_ms = 50,
+		.n2 = 2,
+		.adaptive_timeouts = true,
+	};
+
+	const struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_timers_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_timers_dlci1_receive_buf),
+		.transmit_buf = cmux_timers_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_timers_dlci1_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_timers_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_timers_bus_mock_rx_buf),
+		.tx_buf = cmux_timers_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_timers_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_timers, &cmux_config);
+
+	cmux_timers_dlci1_pipe = modem_cmux_dlci_init(&cmux_timers, &cmux_timers_dlci1,
+						      &dlci1_config);
+
+	modem_pipe_attach(cmux_timers_dlci1_pipe, test_modem_cmux_timers_dlci1_pipe_callback,
+			  NULL);
+
+	cmux_timers_bus_mock_pipe = modem_backend_mock_init(&cmux_timers_bus_mock,
+							    &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_timers_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_timers, cmux_timers_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	k_event_clear(&cmux_event, EVENT_CMUX_TIMERS_CONNECTED | EVENT_CMUX_TIMERS_CONNECT_FAILED |
+				   EVENT_CMUX_TIMERS_DLCI1_CLOSED);
+
+	/* SABM is retransmitted N2 times every T1 before connecting fails */
+	zassert_true(modem_cmux_connect_async(&cmux_timers) == 0, "Failed to connect CMUX");
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_TIMERS_CONNECT_FAILED, false,
+			      K_MSEC(500));
+	zassert_true((events & EVENT_CMUX_TIMERS_CONNECT_FAILED), "Connect failure not reported");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&cmux_timers_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == (sizeof(cmux_frame_control_sabm_cmd) * 3),
+		     "Incorrect number of SABM frames transmitted");
+
+	for (int i = 0; i < 3; i++) {
+		zassert_true(memcmp(&buffer1[i * sizeof(cmux_frame_control_sabm_cmd)],
+				    cmux_frame_control_sabm_cmd,
+				    sizeof(cmux_frame_control_sabm_cmd)) == 0,
+			     "Incorrect SABM frame transmitted");
+	}
+
+	/* Quickly answered SABM shortens T1 */
+	zassert_true(modem_cmux_connect_async(&cmux_timers) == 0, "Failed to connect CMUX");
+
+	k_msleep(2);
+
+	modem_backend_mock_reset(&cmux_timers_bus_mock);
+
+	modem_backend_mock_put(&cmux_timers_bus_mock, cmux_frame_control_sabm_ack,
+			       sizeof(cmux_frame_control_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_TIMERS_CONNECTED, false, K_MSEC(100));
+	zassert_true((events & EVENT_CMUX_TIMERS_CONNECTED), "CMUX not connected");
+
+	zassert_true(modem_pipe_open_async(cmux_timers_dlci1_pipe) == 0,
+		     "Failed to open DLCI1 pipe");
+
+	k_msleep(5);
+
+	ret = modem_backend_mock_get(&cmux_timers_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_sabm_cmd), "Incorrect SABM size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_sabm_cmd, ret) == 0,
+		     "Incorrect SABM transmitted");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_timers_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_sabm_cmd), "SABM not retransmitted");
+
+	/* DLCI pipe is closed once N2 retransmissions are not answered */
+	events = k_event_wait(&cmux_event, EVENT_CMUX_TIMERS_DLCI1_CLOSED, false, K_MSEC(40));
+	zassert_true((events & EVENT_CMUX_TIMERS_DLCI1_CLOSED), "DLCI1 not closed");
+
+	ret = modem_backend_mock_get(&cmux_timers_bus_mock, buffer1, sizeof(buffer1));
+	zassert_true(ret == sizeof(cmux_frame_dlci1_sabm_cmd),
+		     "Incorrect number of SABM frames transmitted");
+}
+
+ZTEST(modem_cmux, modem_cmux_dlcis_close_open)
+{
+	struct modem_cmux_dlci *const dlcis[] = {&dlci1, &dlci2};
+	int ret;
+	uint32_t events;
+
+	/* Close DLCI1 and DLCI2 with both DISC frames in flight */
+	zassert_true(modem_cmux_dlcis_close_async(&cmux, dlcis, ARRAY_SIZE(dlcis)) == 0,
+		     "Failed to close DLCIs");
+
+	zassert_true(modem_cmux_dlcis_close_async(&cmux, dlcis, ARRAY_SIZE(dlcis)) == -EBUSY,
+		     "DLCIs should already be closing");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (sizeof(cmux_frame_dlci1_disc_cmd) +
+			     sizeof(cmux_frame_dlci2_disc_cmd)),
+		     "Incorrect number of bytes received for DLCI close cmds");
+
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_disc_cmd,
+			    sizeof(cmux_frame_dlci1_disc_cmd)) == 0,
+		     "Incorrect DLCI1 close cmd received");
+
+	zassert_true(memcmp(&buffer1[sizeof(cmux_frame_dlci1_disc_cmd)],
+			    cmux_frame_dlci2_disc_cmd, sizeof(cmux_frame_dlci2_disc_cmd)) == 0,
+		     "Incorrect DLCI2 close cmd received");
+
+	/* Answer out of order, completion awaits the last UA */
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_ua_ack,
+			       sizeof(cmux_frame_dlci2_ua_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI2_CLOSED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI2_CLOSED), "DLCI2 not closed as expected");
+	zassert_false((events & EVENT_CMUX_DLCIS_DONE), "DLCIs closed before DLCI1");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_ua_ack,
+			       sizeof(cmux_frame_dlci1_ua_ack));
+
+	events = k_event_wait_all(&cmux_event, (EVENT_CMUX_DLCI1_CLOSED | EVENT_CMUX_DLCIS_DONE),
+				  false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI1_CLOSED), "DLCI1 not closed as expected");
+	zassert_true((events & EVENT_CMUX_DLCIS_DONE), "DLCIs not closed as expected");
+
+	/* Closing closed DLCIs completes immediately */
+	zassert_true(modem_cmux_dlcis_close(&cmux, dlcis, ARRAY_SIZE(dlcis)) == 0,
+		     "Failed to close closed DLCIs");
+
+	k_event_clear(&cmux_event, EVENT_CMUX_DLCIS_DONE);
+
+	/* Open DLCI1 and DLCI2 with both SABM frames in flight */
+	zassert_true(modem_cmux_dlcis_open_async(&cmux, dlcis, ARRAY_SIZE(dlcis)) == 0,
+		     "Failed to open DLCIs");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (sizeof(cmux_frame_dlci1_sabm_cmd) +
+			     sizeof(cmux_frame_dlci2_sabm_cmd)),
+		     "Incorrect number of bytes received for DLCI open cmds");
+
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_sabm_cmd,
+			    sizeof(cmux_frame_dlci1_sabm_cmd)) == 0,
+		     "Incorrect DLCI1 open cmd received");
+
+	zassert_true(memcmp(&buffer1[sizeof(cmux_frame_dlci1_sabm_cmd)],
+			    cmux_frame_dlci2_sabm_cmd, sizeof(cmux_frame_dlci2_sabm_cmd)) == 0,
+		     "Incorrect DLCI2 open cmd received");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci2_sabm_ack,
+			       sizeof(cmux_frame_dlci2_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_DLCI2_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI2_OPEN), "DLCI2 not opened as expected");
+	zassert_false((events & EVENT_CMUX_DLCIS_DONE), "DLCIs opened before DLCI1");
+
+	modem_backend_mock_put(&bus_mock, cmux_frame_dlci1_sabm_ack,
+			       sizeof(cmux_frame_dlci1_sabm_ack));
+
+	events = k_event_wait_all(&cmux_event, (EVENT_CMUX_DLCI1_OPEN | EVENT_CMUX_DLCIS_DONE),
+				  false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_DLCI1_OPEN), "DLCI1 not opened as expected");
+	zassert_true((events & EVENT_CMUX_DLCIS_DONE), "DLCIs not opened as expected");
+
+	/* Opening open DLCIs completes immediately */
+	zassert_true(modem_cmux_dlcis_open(&cmux, dlcis, ARRAY_SIZE(dlcis)) == 0,
+		     "Failed to open open DLCIs");
+
+	/* Wait for potential T1 timeout */
+	k_msleep(500);
+
+	ret = modem_backend_mock_get(&bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Received unexpected data");
+
+	/* Waiting allows for retransmissions of DISC and SABM, beyond T2 */
+	k_work_schedule(&dlci1_ua_late_work, K_MSEC(800));
+
+	zassert_true(modem_cmux_dlcis_close(&cmux, dlcis, 1) == 0,
+		     "DLCI1 close should await retransmissions");
+
+	k_work_schedule(&dlci1_ua_late_work, K_MSEC(800));
+
+	zassert_true(modem_cmux_dlcis_open(&cmux, dlcis, 1) == 0,
+		     "DLCI1 open should await retransmissions");
+
+	modem_backend_mock_reset(&bus_mock);
+}
+
+ZTEST(modem_cmux, modem_cmux_static)
+{
+	struct modem_cmux *cmux_static = MODEM_CMUX_GET(cmux_static);
+	int ret;
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_static_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_static_bus_mock_rx_buf),
+		.tx_buf = cmux_static_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_static_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	/* DLCIs are initialized at boot and looked up by address */
+	zassert_true(cmux_static->dlci_table[1] == MODEM_CMUX_DLCI_GET(cmux_static, 1),
+		     "DLCI1 not in DLCI table");
+	zassert_true(cmux_static->dlci_table[2] == MODEM_CMUX_DLCI_GET(cmux_static, 2),
+		     "DLCI2 not in DLCI table");
+	zassert_true(MODEM_CMUX_DLCI_GET(cmux_static, 2)->priority == 1,
+		     "DLCI2 configuration not applied");
+
+	cmux_static_bus_mock_pipe = modem_backend_mock_init(&cmux_static_bus_mock,
+							    &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_static_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(cmux_static, cmux_static_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	modem_backend_mock_prime(&cmux_static_bus_mock, &transaction_control_sabm);
+
+	zassert_true(modem_cmux_connect(cmux_static) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_prime(&cmux_static_bus_mock, &transaction_dlci1_sabm);
+
+	zassert_true(modem_pipe_open(MODEM_CMUX_DLCI_PIPE_GET(cmux_static, 1)) == 0,
+		     "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_prime(&cmux_static_bus_mock, &transaction_dlci2_sabm);
+
+	zassert_true(modem_pipe_open(MODEM_CMUX_DLCI_PIPE_GET(cmux_static, 2)) == 0,
+		     "Failed to open DLCI2 pipe");
+
+	modem_backend_mock_put(&cmux_static_bus_mock, cmux_frame_dlci2_at_cgdcont,
+			       sizeof(cmux_frame_dlci2_at_cgdcont));
+
+	k_msleep(100);
+
+	ret = modem_pipe_receive(MODEM_CMUX_DLCI_PIPE_GET(cmux_static, 2), buffer2,
+				 sizeof(buffer2));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci2_at_cgdcont),
+		     "Incorrect number of bytes received");
+
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci2_at_cgdcont, ret) == 0,
+		     "Incorrect data received");
+
+	modem_backend_mock_prime(&cmux_static_bus_mock, &transaction_control_cld);
+
+	zassert_true(modem_cmux_disconnect(cmux_static) == 0, "Failed to disconnect CMUX");
+
+	modem_cmux_release(cmux_static);
+
+	/* DLCI addresses not contiguous from 1 are rejected */
+	zassert_true(modem_cmux_init_internal(&cmux_invalid, &cmux_invalid_config,
+					      cmux_invalid_dlcis, cmux_invalid_dlci_configs,
+					      ARRAY_SIZE(cmux_invalid_dlci_configs),
+					      &cmux_invalid_dlci_bufs[0][0][0],
+					      sizeof(cmux_invalid_dlci_bufs[0][0])) == -EINVAL,
+		     "DLCI addresses not contiguous should be rejected");
+}
+
+ZTEST(modem_cmux, modem_cmux_direct_transmit)
+{
+	int ret;
+
+	const struct modem_cmux_config cmux_config = {
+		.receive_buf = cmux_direct_receive_buf,
+		.receive_buf_size = sizeof(cmux_direct_receive_buf),
+		.transmit_buf = cmux_direct_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_direct_transmit_buf),
+		.direct_transmit = true,
+	};
+
+	const struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_direct_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_direct_dlci1_receive_buf),
+		.transmit_buf = cmux_direct_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_direct_dlci1_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_direct_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_direct_bus_mock_rx_buf),
+		.tx_buf = cmux_direct_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_direct_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_direct, &cmux_config);
+
+	cmux_direct_dlci1_pipe = modem_cmux_dlci_init(&cmux_direct, &cmux_direct_dlci1,
+						      &dlci1_config);
+
+	cmux_direct_bus_mock_pipe = modem_backend_mock_init(&cmux_direct_bus_mock,
+							    &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_direct_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_direct, cmux_direct_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	modem_backend_mock_prime(&cmux_direct_bus_mock, &transaction_control_sabm);
+
+	zassert_true(modem_cmux_connect(&cmux_direct) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_prime(&cmux_direct_bus_mock, &transaction_dlci1_sabm);
+
+	zassert_true(modem_pipe_open(cmux_direct_dlci1_pipe) == 0, "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_reset(&cmux_direct_bus_mock);
+
+	/* Frame is on the bus when transmit returns, without waiting for the transmit work */
+	ret = modem_pipe_transmit(cmux_direct_dlci1_pipe, cmux_frame_data_dlci1_at_at,
+				  sizeof(cmux_frame_data_dlci1_at_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Failed to transmit");
+
+	zassert_true(k_work_delayable_busy_get(&cmux_direct.transmit_work.dwork) == 0,
+		     "Transmit work used while idle");
+
+	ret = modem_backend_mock_get(&cmux_direct_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci1_at_at_tx),
+		     "Incorrect number of bytes transmitted");
+
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_at_at_tx, ret) == 0,
+		     "Incorrect data transmitted");
+
+	modem_backend_mock_prime(&cmux_direct_bus_mock, &transaction_control_cld);
+
+	zassert_true(modem_cmux_disconnect(&cmux_direct) == 0, "Failed to disconnect CMUX");
+
+	modem_cmux_release(&cmux_direct);
+}
+
+ZTEST(modem_cmux, modem_cmux_segmented_transmit)
+{
+	uint16_t offset = 0;
+	uint16_t data_len;
+	int ret;
+
+	const struct modem_cmux_config cmux_config = {
+		.receive_buf = cmux_segment_receive_buf,
+		.receive_buf_size = sizeof(cmux_segment_receive_buf),
+		.transmit_buf = cmux_segment_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_segment_transmit_buf),
+	};
+
+	const struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_segment_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_segment_dlci1_receive_buf),
+		.transmit_buf = cmux_segment_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_segment_dlci1_transmit_buf),
+		.data_size_max = 32,
+		.atomic_transmit = true,
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_segment_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_segment_bus_mock_rx_buf),
+		.tx_buf = cmux_segment_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_segment_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_segment, &cmux_config);
+
+	cmux_segment_dlci1_pipe = modem_cmux_dlci_init(&cmux_segment, &cmux_segment_dlci1,
+						       &dlci1_config);
+
+	cmux_segment_bus_mock_pipe = modem_backend_mock_init(&cmux_segment_bus_mock,
+							     &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_segment_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_segment, cmux_segment_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	modem_backend_mock_prime(&cmux_segment_bus_mock, &transaction_control_sabm);
+
+	zassert_true(modem_cmux_connect(&cmux_segment) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_prime(&cmux_segment_bus_mock, &transaction_dlci1_sabm);
+
+	zassert_true(modem_pipe_open(cmux_segment_dlci1_pipe) == 0, "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_reset(&cmux_segment_bus_mock);
+
+	for (uint16_t i = 0; i < 120; i++) {
+		buffer2[i] = (uint8_t)i;
+	}
+
+	/* Write larger than transmit queue can never be queued entirely */
+	ret = modem_pipe_transmit(cmux_segment_dlci1_pipe, buffer2,
+				  sizeof(cmux_segment_dlci1_transmit_buf) + 1);
+
+	zassert_true(ret == -EMSGSIZE, "Oversized write should be rejected");
+
+	ret = modem_pipe_transmit(cmux_segment_dlci1_pipe, buffer2, 120);
+
+	zassert_true(ret == 120, "Write should be queued entirely");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&cmux_segment_bus_mock, buffer1, sizeof(buffer1));
+
+	/* Four frames with 32, 32, 32 and 24 bytes of data, each wrapped in 6 bytes */
+	zassert_true(ret == (120 + (4 * 6)), "Incorrect number of bytes transmitted");
+
+	for (uint8_t i = 0; i < 4; i++) {
+		data_len = (i < 3) ? 32 : 24;
+
+		zassert_true(buffer1[offset] == 0xF9, "Frame %u flag not found", i);
+		zassert_true(buffer1[offset + 3] == ((data_len << 1) | 0x01),
+			     "Frame %u has incorrect length", i);
+		zassert_true(memcmp(&buffer1[offset + 4], &buffer2[i * 32], data_len) == 0,
+			     "Frame %u has incorrect data", i);
+
+		offset += data_len + 6;
+	}
+
+	modem_backend_mock_prime(&cmux_segment_bus_mock, &transaction_control_cld);
+
+	zassert_true(modem_cmux_disconnect(&cmux_segment) == 0, "Failed to disconnect CMUX");
+
+	modem_cmux_release(&cmux_segment);
+}
+
+ZTEST(modem_cmux, modem_cmux_staged_transmit)
+{
+	uint16_t offset = 0;
+	uint16_t frame_offset;
+	bool partial = false;
+	size_t size;
+	int ret;
+
+	const struct modem_cmux_config cmux_config = {
+		.receive_buf = cmux_stage_receive_buf,
+		.receive_buf_size = sizeof(cmux_stage_receive_buf),
+		.transmit_buf = cmux_stage_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_stage_transmit_buf),
+		.transmit_stage_buf = cmux_stage_transmit_stage_buf,
+		.transmit_stage_buf_size = sizeof(cmux_stage_transmit_stage_buf),
+	};
+
+	const struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_stage_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_stage_dlci1_receive_buf),
+		.transmit_buf = cmux_stage_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_stage_dlci1_transmit_buf),
+		.data_size_max = 20,
+	};
+
+	/* Bus accepts less than the stage buffer holds */
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_stage_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_stage_bus_mock_rx_buf),
+		.tx_buf = cmux_stage_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_stage_bus_mock_tx_buf),
+		.limit = 40,
+		.transmit_log = cmux_stage_bus_mock_transmit_log,
+		.transmit_log_size = ARRAY_SIZE(cmux_stage_bus_mock_transmit_log),
+	};
+
+	modem_cmux_init(&cmux_stage, &cmux_config);
+
+	cmux_stage_dlci1_pipe = modem_cmux_dlci_init(&cmux_stage, &cmux_stage_dlci1,
+						     &dlci1_config);
+
+	cmux_stage_bus_mock_pipe = modem_backend_mock_init(&cmux_stage_bus_mock,
+							   &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_stage_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_stage, cmux_stage_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	modem_backend_mock_prime(&cmux_stage_bus_mock, &transaction_control_sabm);
+
+	zassert_true(modem_cmux_connect(&cmux_stage) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_prime(&cmux_stage_bus_mock, &transaction_dlci1_sabm);
+
+	zassert_true(modem_pipe_open(cmux_stage_dlci1_pipe) == 0, "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_reset(&cmux_stage_bus_mock);
+
+	for (uint16_t i = 0; i < 120; i++) {
+		buffer2[i] = (uint8_t)i;
+	}
+
+	/* Six frames of 26 bytes exceed the transmit buffer, so the queued frames wrap */
+	ret = modem_pipe_transmit(cmux_stage_dlci1_pipe, buffer2, 120);
+
+	zassert_true(ret == 120, "Write should be queued entirely");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&cmux_stage_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == (6 * 26), "Incorrect number of bytes transmitted");
+
+	for (uint8_t i = 0; i < 6; i++) {
+		frame_offset = i * 26;
+
+		zassert_true(buffer1[frame_offset] == 0xF9, "Frame %u SOF not found", i);
+		zassert_true(buffer1[frame_offset + 3] == ((20 << 1) | 0x01),
+			     "Frame %u has incorrect length", i);
+		zassert_true(memcmp(&buffer1[frame_offset + 4], &buffer2[i * 20], 20) == 0,
+			     "Frame %u has incorrect data", i);
+		zassert_true(buffer1[frame_offset + 25] == 0xF9, "Frame %u EOF not found", i);
+	}
+
+	/*
+	 * Each transmit call starts with the bytes not accepted by the previous call, and is
+	 * filled up with whole frames only, in one burst across the wrap of transmit buffer.
+	 */
+	for (uint8_t i = 0; i < cmux_stage_bus_mock.transmit_log_cnt; i++) {
+		size = cmux_stage_bus_mock_transmit_log[i];
+
+		zassert_true(size <= sizeof(cmux_stage_transmit_stage_buf),
+			     "Transmit call %u exceeds stage buffer", i);
+		zassert_true(((offset + size) % 26) == 0,
+			     "Transmit call %u does not end with whole frame", i);
+
+		if (size > bus_mock_config.limit) {
+			partial = true;
+		}
+
+		offset += MIN(size, bus_mock_config.limit);
+	}
+
+	zassert_true(partial == true, "Bus never accepted part of a transmit call");
+	zassert_true(offset == (6 * 26), "Bytes not accepted by bus were not transmitted next");
+
+	modem_backend_mock_prime(&cmux_stage_bus_mock, &transaction_control_cld);
+
+	zassert_true(modem_cmux_disconnect(&cmux_stage) == 0, "Failed to disconnect CMUX");
+
+	modem_cmux_release(&cmux_stage);
+}
+
+/* Get DLCI addresses of data frames transmitted to bus, skipping control channel frames */
+static uint8_t test_modem_cmux_transmitted_dlcis(struct modem_backend_mock *mock,
+						 uint8_t *dlcis, uint8_t dlcis_size)
+{
+	uint8_t count = 0;
+	uint16_t offset = 0;
+	int ret;
+
+	ret = modem_backend_mock_get(mock, buffer1, sizeof(buffer1));
+
+	/* Basic option frames of less than 128 bytes of data */
+	while ((offset + 6) <= ret) {
+		zassert_true(buffer1[offset] == 0xF9, "Frame flag not found");
+
+		if (((buffer1[offset + 1] >> 2) != 0) && (count < dlcis_size)) {
+			dlcis[count] = buffer1[offset + 1] >> 2;
+			count++;
+		}
+
+		offset += (buffer1[offset + 3] >> 1) + 6;
+	}
+
+	return count;
+}
+
+ZTEST(modem_cmux, modem_cmux_transmit_scheduling)
+{
+	uint8_t dlcis[16];
+	uint8_t count;
+	int ret;
+
+	const struct modem_cmux_config cmux_config = {
+		.receive_buf = cmux_schedule_receive_buf,
+		.receive_buf_size = sizeof(cmux_schedule_receive_buf),
+		.transmit_buf = cmux_schedule_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_schedule_transmit_buf),
+		.receive_budget = sizeof(cmux_schedule_bus_mock_rx_buf),
+	};
+
+	/* DLCI1 has highest priority, DLCI2 and DLCI3 share priority with weights 1 and 3 */
+	const uint8_t priorities[] = {0, 1, 1};
+	const uint8_t weights[] = {1, 1, 3};
+
+	/* DLCI2 and DLCI3 are served round robin with DLCI3 transmitting 3 frames in a row */
+	const uint8_t weighted[] = {3, 3, 3, 2, 3, 3, 3, 2, 2, 2};
+
+	const struct modem_backend_mock_transaction *sabm_transactions[] = {
+		&transaction_dlci1_sabm,
+		&transaction_dlci2_sabm,
+		&transaction_dlci3_sabm,
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_schedule_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_schedule_bus_mock_rx_buf),
+		.tx_buf = cmux_schedule_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_schedule_bus_mock_tx_buf),
+		.limit = sizeof(cmux_schedule_bus_mock_tx_buf),
+	};
+
+	modem_cmux_init(&cmux_schedule, &cmux_config);
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(cmux_schedule_dlcis); i++) {
+		const struct modem_cmux_dlci_config dlci_config = {
+			.dlci_address = i + 1,
+			.receive_buf = cmux_schedule_dlci_receive_bufs[i],
+			.receive_buf_size = sizeof(cmux_schedule_dlci_receive_bufs[i]),
+			.transmit_buf = cmux_schedule_dlci_transmit_bufs[i],
+			.transmit_buf_size = sizeof(cmux_schedule_dlci_transmit_bufs[i]),
+			.priority = priorities[i],
+			.weight = weights[i],
+			.data_size_max = 8,
+		};
+
+		cmux_schedule_dlci_pipes[i] = modem_cmux_dlci_init(&cmux_schedule,
+								   &cmux_schedule_dlcis[i],
+								   &dlci_config);
+	}
+
+	cmux_schedule_bus_mock_pipe = modem_backend_mock_init(&cmux_schedule_bus_mock,
+							      &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_schedule_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_schedule, cmux_schedule_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	modem_backend_mock_prime(&cmux_schedule_bus_mock, &transaction_control_sabm);
+
+	zassert_true(modem_cmux_connect(&cmux_schedule) == 0, "Failed to connect CMUX");
+
+	for (uint8_t i = 0; i < ARRAY_SIZE(cmux_schedule_dlcis); i++) {
+		modem_backend_mock_prime(&cmux_schedule_bus_mock, sabm_transactions[i]);
+
+		zassert_true(modem_pipe_open(cmux_schedule_dlci_pipes[i]) == 0,
+			     "Failed to open DLCI%u pipe", i + 1);
+	}
+
+	for (uint16_t i = 0; i < 64; i++) {
+		buffer2[i] = (uint8_t)i;
+	}
+
+	/* Queue data while remote has stopped transmission on all DLCIs */
+	modem_backend_mock_put(&cmux_schedule_bus_mock, cmux_frame_control_msc_dlcis_fc_cmd,
+			       sizeof(cmux_frame_control_msc_dlcis_fc_cmd));
+
+	k_msleep(100);
+
+	modem_backend_mock_reset(&cmux_schedule_bus_mock);
+
+	/* Bulk data of low priority DLCI2 is queued ahead of data of high priority DLCI1 */
+	ret = modem_pipe_transmit(cmux_schedule_dlci_pipes[1], buffer2, 32);
+
+	zassert_true(ret == 32, "Failed to queue DLCI2 data");
+
+	ret = modem_pipe_transmit(cmux_schedule_dlci_pipes[0], buffer2, 8);
+
+	zassert_true(ret == 8, "Failed to queue DLCI1 data");
+
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&cmux_schedule_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == 0, "Data transmitted while flow control is asserted");
+
+	/* Resume DLCI2 ahead of DLCI1, in one turn of receiving */
+	modem_backend_mock_put(&cmux_schedule_bus_mock, cmux_frame_control_msc_dlci2_dlci1_cmd,
+			       sizeof(cmux_frame_control_msc_dlci2_dlci1_cmd));
+
+	k_msleep(100);
+
+	count = test_modem_cmux_transmitted_dlcis(&cmux_schedule_bus_mock, dlcis,
+						  ARRAY_SIZE(dlcis));
+
+	zassert_true(count == 5, "Expected one DLCI1 frame and four DLCI2 frames");
+	zassert_true(dlcis[0] == 1, "DLCI1 frame not transmitted first");
+
+	for (uint8_t i = 1; i < count; i++) {
+		zassert_true(dlcis[i] == 2, "Frame %u not transmitted on DLCI2", i);
+	}
+
+	/* DLCIs sharing priority are interleaved by weight */
+	modem_backend_mock_put(&cmux_schedule_bus_mock, cmux_frame_control_msc_dlcis_fc_cmd,
+			       sizeof(cmux_frame_control_msc_dlcis_fc_cmd));
+
+	k_msleep(100);
+
+	modem_backend_mock_reset(&cmux_schedule_bus_mock);
+
+	ret = modem_pipe_transmit(cmux_schedule_dlci_pipes[1], buffer2, 32);
+
+	zassert_true(ret == 32, "Failed to queue DLCI2 data");
+
+	ret = modem_pipe_transmit(cmux_schedule_dlci_pipes[2], buffer2, 48);
+
+	zassert_true(ret == 48, "Failed to queue DLCI3 data");
+
+	modem_backend_mock_put(&cmux_schedule_bus_mock, cmux_frame_control_msc_dlci2_dlci3_cmd,
+			       sizeof(cmux_frame_control_msc_dlci2_dlci3_cmd));
+
+	k_msleep(100);
+
+	count = test_modem_cmux_transmitted_dlcis(&cmux_schedule_bus_mock, dlcis,
+						  ARRAY_SIZE(dlcis));
+
+	zassert_true(count == ARRAY_SIZE(weighted), "Incorrect number of frames transmitted");
+
+	for (uint8_t i = 0; i < count; i++) {
+		zassert_true(dlcis[i] == weighted[i], "Frame %u transmitted on DLCI%u, expected %u",
+			     i, dlcis[i], weighted[i]);
+	}
+
+	modem_backend_mock_prime(&cmux_schedule_bus_mock, &transaction_control_cld);
+
+	zassert_true(modem_cmux_disconnect(&cmux_schedule) == 0, "Failed to disconnect CMUX");
+
+	modem_cmux_release(&cmux_schedule);
+}
+
+ZTEST(modem_cmux, modem_cmux_power_save)
+{
+	uint32_t events;
+	int ret;
+
+	struct modem_cmux_config cmux_config = {
+		.callback = test_modem_cmux_power_save_callback,
+		.user_data = NULL,
+		.receive_buf = cmux_power_save_receive_buf,
+		.receive_buf_size = sizeof(cmux_power_save_receive_buf),
+		.transmit_buf = cmux_power_save_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_power_save_transmit_buf),
+		.power_save_timeout_ms = 100,
+	};
+
+	struct modem_cmux_dlci_config dlci1_config = {
+		.dlci_address = 1,
+		.receive_buf = cmux_power_save_dlci1_receive_buf,
+		.receive_buf_size = sizeof(cmux_power_save_dlci1_receive_buf),
+		.transmit_buf = cmux_power_save_dlci1_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_power_save_dlci1_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_power_save_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_power_save_bus_mock_rx_buf),
+		.tx_buf = cmux_power_save_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_power_save_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_power_save, &cmux_config);
+
+	cmux_power_save_dlci1_pipe = modem_cmux_dlci_init(&cmux_power_save,
+							  &cmux_power_save_dlci1, &dlci1_config);
+
+	cmux_power_save_bus_mock_pipe = modem_backend_mock_init(&cmux_power_save_bus_mock,
+								&bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_power_save_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_power_save, cmux_power_save_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	zassert_true(modem_cmux_connect_async(&cmux_power_save) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_control_sabm_ack,
+			       sizeof(cmux_frame_control_sabm_ack));
+
+	k_msleep(10);
+
+	modem_pipe_attach(cmux_power_save_dlci1_pipe,
+			  test_modem_cmux_power_save_dlci1_pipe_callback, NULL);
+
+	zassert_true(modem_pipe_open_async(cmux_power_save_dlci1_pipe) == 0,
+		     "Failed to open DLCI1 pipe");
+
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_dlci1_sabm_ack,
+			       sizeof(cmux_frame_dlci1_sabm_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_POWER_SAVE_DLCI1_OPEN, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_POWER_SAVE_DLCI1_OPEN), "DLCI1 not opened as expected");
+
+	modem_backend_mock_reset(&cmux_power_save_bus_mock);
+
+	/* Power saving is requested when idle */
+	k_msleep(150);
+
+	ret = modem_backend_mock_get(&cmux_power_save_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_psc_cmd), "Incorrect PSC size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_psc_cmd, ret) == 0,
+		     "Incorrect PSC transmitted");
+
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_control_psc_ack,
+			       sizeof(cmux_frame_control_psc_ack));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_POWER_SAVE_ENTERED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_POWER_SAVE_ENTERED), "Power save not entered");
+
+	/* Data transmitted while power saving starts wake-up procedure */
+	ret = modem_pipe_transmit(cmux_power_save_dlci1_pipe, cmux_frame_data_dlci1_at_at,
+				  sizeof(cmux_frame_data_dlci1_at_at));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Failed to transmit data");
+
+	k_msleep(5);
+
+	ret = modem_backend_mock_get(&cmux_power_save_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_wake_up_flags), "Incorrect wake-up flags size");
+	zassert_true(memcmp(buffer1, cmux_frame_wake_up_flags, ret) == 0,
+		     "Incorrect wake-up flags transmitted");
+
+	/* Flags from remote complete wake-up procedure, queued data is then transmitted */
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_wake_up_flags, 3);
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_POWER_SAVE_EXITED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_POWER_SAVE_EXITED), "Power save not exited");
+
+	k_msleep(5);
+
+	ret = modem_backend_mock_get(&cmux_power_save_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_dlci1_at_at_tx), "Incorrect data frame size");
+	zassert_true(memcmp(buffer1, cmux_frame_dlci1_at_at_tx, ret) == 0,
+		     "Incorrect data frame transmitted");
+
+	/* Power saving requested by remote */
+	k_event_clear(&cmux_event, EVENT_CMUX_POWER_SAVE_ENTERED | EVENT_CMUX_POWER_SAVE_EXITED);
+
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_control_psc_remote_cmd,
+			       sizeof(cmux_frame_control_psc_remote_cmd));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_POWER_SAVE_ENTERED, false, K_MSEC(50));
+
+	zassert_true((events & EVENT_CMUX_POWER_SAVE_ENTERED), "Power save not entered");
+
+	ret = modem_backend_mock_get(&cmux_power_save_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_psc_ack), "Incorrect PSC response size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_psc_ack, ret) == 0,
+		     "Incorrect PSC response transmitted");
+
+	/* Wake-up procedure initiated by remote is answered, and following frame received */
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_wake_up_flags, 3);
+
+	modem_backend_mock_put(&cmux_power_save_bus_mock, cmux_frame_dlci1_at_at,
+			       sizeof(cmux_frame_dlci1_at_at));
+
+	events = k_event_wait(&cmux_event, EVENT_CMUX_POWER_SAVE_EXITED, false, K_MSEC(100));
+
+	zassert_true((events & EVENT_CMUX_POWER_SAVE_EXITED), "Power save not exited");
+
+	k_msleep(10);
+
+	ret = modem_backend_mock_get(&cmux_power_save_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_wake_up_flags), "Incorrect wake-up flags size");
+	zassert_true(memcmp(buffer1, cmux_frame_wake_up_flags, ret) == 0,
+		     "Incorrect wake-up flags transmitted");
+
+	ret = modem_pipe_receive(cmux_power_save_dlci1_pipe, buffer2, sizeof(buffer2));
+
+	zassert_true(ret == sizeof(cmux_frame_data_dlci1_at_at), "Incorrect data size received");
+	zassert_true(memcmp(buffer2, cmux_frame_data_dlci1_at_at, ret) == 0,
+		     "Incorrect data received");
+}
+
+ZTEST(modem_cmux, modem_cmux_keepalive)
+{
+	struct modem_cmux_keepalive_stats stats;
+	uint32_t events;
+	int ret;
+
+	struct modem_cmux_config cmux_config = {
+		.callback = test_modem_cmux_keepalive_callback,
+		.user_data = NULL,
+		.receive_buf = cmux_keepalive_receive_buf,
+		.receive_buf_size = sizeof(cmux_keepalive_receive_buf),
+		.transmit_buf = cmux_keepalive_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_keepalive_transmit_buf),
+		.keepalive_interval_ms = 100,
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = cmux_keepalive_bus_mock_rx_buf,
+		.rx_buf_size = sizeof(cmux_keepalive_bus_mock_rx_buf),
+		.tx_buf = cmux_keepalive_bus_mock_tx_buf,
+		.tx_buf_size = sizeof(cmux_keepalive_bus_mock_tx_buf),
+		.limit = 32,
+	};
+
+	modem_cmux_init(&cmux_keepalive, &cmux_config);
+
+	cmux_keepalive_bus_mock_pipe = modem_backend_mock_init(&cmux_keepalive_bus_mock,
+							       &bus_mock_config);
+
+	zassert_true(modem_pipe_open(cmux_keepalive_bus_mock_pipe) == 0, "Failed to open bus");
+
+	zassert_true(modem_cmux_attach(&cmux_keepalive, cmux_keepalive_bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	zassert_true(modem_cmux_connect_async(&cmux_keepalive) == 0, "Failed to connect CMUX");
+
+	modem_backend_mock_put(&cmux_keepalive_bus_mock, cmux_frame_control_sabm_ack,
+			       sizeof(cmux_frame_control_sabm_ack));
+
+	k_msleep(10);
+
+	modem_backend_mock_reset(&cmux_keepalive_bus_mock);
+
+	/* TEST command is transmitted after keepalive interval */
+	k_msleep(100);
+
+	ret = modem_backend_mock_get(&cmux_keepalive_bus_mock, buffer1, sizeof(buffer1));
+
+	zassert_true(ret == sizeof(cmux_frame_control_test_cmd), "Incorrect TEST size");
+	zassert_true(memcmp(buffer1, cmux_frame_control_test_cmd, ret) == 0,
+		     "Incorrect TEST transmitted");
+
+	/* Echoed payload is validated and round trip time measured */
+	k_msleep(20);
+
+	modem_backend_mock_put(&cmux_keepalive_bus_mock, cmux_frame_control_test_ack,
+			       sizeof(cmux_frame_control_test_ack));
+
+	k_msleep(10);
+
+	modem_cmux_get_keepalive_stats(&cmux_keepalive, &stats);
+
+	zassert_true(stats.sent == 1, "Incorrect number of TEST commands sent");
+	zassert_true(stats.received == 1, "Incorrect number of TEST responses received");
+	zassert_true(stats.missed == 0, "Incorrect number of TEST commands missed");
+	zassert_true(stats.rtt_min_us >= 20000, "Incorrect min RTT");
+	zassert_true(stats.rtt_min_us == stats.rtt_max_us, "Incorrect max RTT");
+	zassert_true(stats.rtt_min_us == stats.rtt_avg_us, "Incorrect avg RTT");
+
+	/* Stale response does not count as answer to next TEST command */
+	k_msleep(100);
+
+	modem_backend_mock_put(&cmux_keepalive_bus_mock, cmux_frame_control_test_ack,
+			       sizeof(cmux_frame_control_test_ack));
+
+	/* Unresponsive remote is reported after consecutive missed TEST commands */
+	events = k_event_wait(&cmux_event, EVENT_CMUX_UNRESPONSIVE, false, K_MSEC(1000));
+
+	zassert_true((events & EVENT_CMUX_UNRESPONSIVE), "Unresponsive remote not reported");
+
+	modem_cmux_get_keepalive_stats(&cmux_keepalive, &stats);
+
+	zassert_true(stats.received == 1, "Incorrect number of TEST responses received");
+	zassert_true(stats.missed == 3, "Incorrect number of TEST commands missed");
+}
+
 ZTEST(modem_cmux, modem_cmux_dlci1_close_open)
 {
 	int ret;
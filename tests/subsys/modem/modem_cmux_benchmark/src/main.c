@@ -0,0 +1,623 @@
+/*
+ * Copyright (c) 2023 Trackunit Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Benchmark of sustained traffic through a CMUX instance, sweeping frame data sizes,
+ * number of DLCIs and DLCI buffer sizes. For each combination, throughput, frame rate and
+ * cycles per byte are reported for received (RX) and transmitted (TX) data.
+ *
+ * A second benchmark receives data on several CMUX instances sharing one executor, sweeping
+ * the number of instances and their receive budget. Aggregate throughput and cycles per
+ * byte show how processing scales with instances, and the spread between the first and last
+ * instance finishing, relative to the duration, shows whether instances are served fairly.
+ *
+ * Run on native_posix with:
+ *
+ *     west build -b native_posix tests/subsys/modem/modem_cmux_benchmark -t run
+ */
+
+/*************************************************************************************************/
+/*                                        Dependencies                                           */
+/*************************************************************************************************/
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+#include <string.h>
+
+#include <zephyr/modem/cmux.h>
+#include <modem_backend_mock.h>
+
+/*************************************************************************************************/
+/*                                         Definitions                                           */
+/*************************************************************************************************/
+#define BENCHMARK_DLCIS_MAX		(4)
+#define BENCHMARK_DLCI_BUF_SIZE_MAX	(2048)
+#define BENCHMARK_FRAME_DATA_SIZE_MAX	(512)
+#define BENCHMARK_FRAME_SIZE_MAX	(BENCHMARK_FRAME_DATA_SIZE_MAX + 7)
+#define BENCHMARK_BYTES			(65536)
+#define BENCHMARK_STALLS_MAX		(1000)
+
+#define BENCHMARK_FRAME_TYPE_SABM	(0x3F)
+#define BENCHMARK_FRAME_TYPE_UA		(0x73)
+#define BENCHMARK_FRAME_TYPE_UIH	(0xEF)
+
+#define BENCHMARK_INSTANCES_MAX		(8)
+#define BENCHMARK_INSTANCE_FRAMES	(64)
+#define BENCHMARK_INSTANCE_DATA_SIZE	(127)
+#define BENCHMARK_INSTANCE_FRAME_SIZE	(BENCHMARK_INSTANCE_DATA_SIZE + 6)
+#define BENCHMARK_INSTANCE_BYTES	(BENCHMARK_INSTANCE_FRAMES * BENCHMARK_INSTANCE_DATA_SIZE)
+#define BENCHMARK_INSTANCE_STREAM_SIZE	(BENCHMARK_INSTANCE_FRAMES * BENCHMARK_INSTANCE_FRAME_SIZE)
+
+/*************************************************************************************************/
+/*                                          Instances                                            */
+/*************************************************************************************************/
+static struct modem_cmux cmux;
+static uint8_t cmux_receive_buf[BENCHMARK_FRAME_DATA_SIZE_MAX];
+static uint8_t cmux_transmit_buf[4096];
+static uint8_t cmux_transmit_stage_buf[1024];
+static struct modem_cmux_dlci dlcis[BENCHMARK_DLCIS_MAX];
+static struct modem_pipe *dlci_pipes[BENCHMARK_DLCIS_MAX];
+static uint8_t dlci_receive_bufs[BENCHMARK_DLCIS_MAX][BENCHMARK_DLCI_BUF_SIZE_MAX];
+static uint8_t dlci_transmit_bufs[BENCHMARK_DLCIS_MAX][BENCHMARK_DLCI_BUF_SIZE_MAX];
+static K_SEM_DEFINE(dlcis_opened_sem, 0, 1);
+
+static struct modem_backend_mock bus_mock;
+static uint8_t bus_mock_rx_buf[4096];
+static uint8_t bus_mock_tx_buf[8192];
+static struct modem_pipe *bus_mock_pipe;
+
+static uint8_t payload[BENCHMARK_FRAME_DATA_SIZE_MAX];
+static uint8_t stream[BENCHMARK_DLCIS_MAX * BENCHMARK_FRAME_SIZE_MAX];
+static uint8_t scratch[4096];
+
+static const uint16_t benchmark_frame_data_sizes[] = {16, 64, 127, 512};
+static const uint8_t benchmark_dlci_counts[] = {1, 2, 4};
+static const uint16_t benchmark_dlci_buf_sizes[] = {128, 512, 2048};
+
+/* CMUX instances sharing executor, each with a single DLCI */
+struct benchmark_instance {
+	struct modem_cmux cmux;
+	uint8_t receive_buf[128];
+	uint8_t transmit_buf[256];
+	struct modem_cmux_dlci dlci;
+	struct modem_pipe *dlci_pipe;
+	uint8_t dlci_receive_buf[512];
+	uint8_t dlci_transmit_buf[128];
+	struct modem_backend_mock bus_mock;
+	uint8_t bus_mock_rx_buf[BENCHMARK_INSTANCE_STREAM_SIZE];
+	uint8_t bus_mock_tx_buf[256];
+	struct modem_pipe *bus_mock_pipe;
+	uint32_t received;
+	bool finished;
+	timing_t finish;
+};
+
+MODEM_CMUX_EXECUTOR_DEFINE(benchmark_executor, 2048, K_PRIO_COOP(7));
+
+static struct benchmark_instance instances[BENCHMARK_INSTANCES_MAX];
+static uint8_t instance_stream[BENCHMARK_INSTANCE_STREAM_SIZE];
+static K_SEM_DEFINE(instances_finished_sem, 0, BENCHMARK_INSTANCES_MAX);
+
+static const uint8_t benchmark_instance_counts[] = {1, 2, 4, 8};
+static const uint16_t benchmark_receive_budgets[] = {16, 256, UINT16_MAX};
+
+/*************************************************************************************************/
+/*                                          Callbacks                                            */
+/*************************************************************************************************/
+static void benchmark_cmux_callback(struct modem_cmux *cmux, enum modem_cmux_event event,
+				    void *user_data)
+{
+	if (event == MODEM_CMUX_EVENT_DLCIS_OPENED) {
+		k_sem_give(&dlcis_opened_sem);
+	}
+}
+
+/* Drain DLCI in executor context, as fast as data is received */
+static void benchmark_instance_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+					     void *user_data)
+{
+	struct benchmark_instance *instance = (struct benchmark_instance *)user_data;
+	int ret;
+
+	if (event != MODEM_PIPE_EVENT_RECEIVE_READY) {
+		return;
+	}
+
+	do {
+		ret = modem_pipe_receive(pipe, scratch, sizeof(scratch));
+
+		if (ret > 0) {
+			instance->received += ret;
+		}
+	} while (ret > 0);
+
+	if ((instance->finished == false) && (instance->received >= BENCHMARK_INSTANCE_BYTES)) {
+		instance->finish = timing_counter_get();
+		instance->finished = true;
+
+		k_sem_give(&instances_finished_sem);
+	}
+}
+
+/*************************************************************************************************/
+/*                                          Helpers                                              */
+/*************************************************************************************************/
+/* Encode frame sent by the remote in basic option */
+static uint16_t benchmark_encode_frame(uint8_t *buf, uint8_t dlci_address, uint8_t type,
+				       const uint8_t *data, uint16_t data_len)
+{
+	uint16_t header_len;
+	uint16_t i = 0;
+
+	buf[i++] = 0xF9;
+	buf[i++] = 0x03 | (dlci_address << 2);
+	buf[i++] = type;
+
+	if (data_len < 128) {
+		buf[i++] = (data_len << 1) | 0x01;
+	} else {
+		buf[i++] = (data_len & 0x7F) << 1;
+		buf[i++] = data_len >> 7;
+	}
+
+	header_len = i - 1;
+
+	memcpy(&buf[i], data, data_len);
+	i += data_len;
+
+	buf[i++] = 0xFF - crc8(&buf[1], header_len, 0xE0, 0xFF, true);
+	buf[i++] = 0xF9;
+
+	return i;
+}
+
+static void benchmark_drain_bus(void)
+{
+	while (modem_backend_mock_get(&bus_mock, scratch, sizeof(scratch)) > 0) {
+	}
+}
+
+static void benchmark_setup_cmux(uint8_t dlcis_size, uint16_t frame_data_size,
+				 uint16_t dlci_buf_size)
+{
+	struct modem_cmux_dlci *dlcis_set[BENCHMARK_DLCIS_MAX];
+	struct modem_backend_mock_transaction transaction_sabm;
+	uint8_t sabm_cmd[8];
+	uint8_t sabm_ack[8];
+	uint8_t ua[8];
+
+	const struct modem_cmux_config cmux_config = {
+		.callback = benchmark_cmux_callback,
+		.receive_buf = cmux_receive_buf,
+		.receive_buf_size = sizeof(cmux_receive_buf),
+		.transmit_buf = cmux_transmit_buf,
+		.transmit_buf_size = sizeof(cmux_transmit_buf),
+		.transmit_stage_buf = cmux_transmit_stage_buf,
+		.transmit_stage_buf_size = sizeof(cmux_transmit_stage_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = bus_mock_rx_buf,
+		.rx_buf_size = sizeof(bus_mock_rx_buf),
+		.tx_buf = bus_mock_tx_buf,
+		.tx_buf_size = sizeof(bus_mock_tx_buf),
+		.limit = sizeof(bus_mock_rx_buf),
+	};
+
+	modem_cmux_init(&cmux, &cmux_config);
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		const struct modem_cmux_dlci_config dlci_config = {
+			.dlci_address = i + 1,
+			.receive_buf = dlci_receive_bufs[i],
+			.receive_buf_size = dlci_buf_size,
+			.transmit_buf = dlci_transmit_bufs[i],
+			.transmit_buf_size = dlci_buf_size,
+			.data_size_max = frame_data_size,
+		};
+
+		dlci_pipes[i] = modem_cmux_dlci_init(&cmux, &dlcis[i], &dlci_config);
+		dlcis_set[i] = &dlcis[i];
+	}
+
+	bus_mock_pipe = modem_backend_mock_init(&bus_mock, &bus_mock_config);
+
+	zassert_true(modem_pipe_open(bus_mock_pipe) == 0, "Failed to open bus");
+	zassert_true(modem_cmux_attach(&cmux, bus_mock_pipe) == 0, "Failed to attach CMUX");
+
+	transaction_sabm.get = sabm_cmd;
+	transaction_sabm.get_size = benchmark_encode_frame(sabm_cmd, 0, BENCHMARK_FRAME_TYPE_SABM,
+							   NULL, 0);
+	transaction_sabm.put = sabm_ack;
+	transaction_sabm.put_size = benchmark_encode_frame(sabm_ack, 0, BENCHMARK_FRAME_TYPE_UA,
+							   NULL, 0);
+
+	modem_backend_mock_prime(&bus_mock, &transaction_sabm);
+
+	zassert_true(modem_cmux_connect(&cmux) == 0, "Failed to connect CMUX");
+
+	/* Answer all SABM frames once transmitted */
+	k_sem_reset(&dlcis_opened_sem);
+
+	zassert_true(modem_cmux_dlcis_open_async(&cmux, dlcis_set, dlcis_size) == 0,
+		     "Failed to open DLCIs");
+
+	benchmark_drain_bus();
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		modem_backend_mock_put(&bus_mock, ua,
+				       benchmark_encode_frame(ua, i + 1, BENCHMARK_FRAME_TYPE_UA,
+							      NULL, 0));
+	}
+
+	zassert_true(k_sem_take(&dlcis_opened_sem, K_SECONDS(1)) == 0, "Failed to open DLCIs");
+
+	benchmark_drain_bus();
+}
+
+static void benchmark_teardown_cmux(void)
+{
+	modem_cmux_release(&cmux);
+}
+
+static void benchmark_report(const char *direction, uint8_t dlcis_size, uint16_t frame_data_size,
+			     uint16_t dlci_buf_size, uint32_t bytes, uint32_t frames,
+			     uint64_t cycles)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+	uint32_t bytes_per_s = (ns == 0) ? 0 : (uint32_t)(((uint64_t)bytes * NSEC_PER_SEC) / ns);
+	uint32_t frames_per_s = (ns == 0) ? 0 : (uint32_t)(((uint64_t)frames * NSEC_PER_SEC) / ns);
+	uint32_t cycles_per_100_bytes = (uint32_t)((cycles * 100) / bytes);
+
+	TC_PRINT("%s %5u %5u %5u %5u.%03u %9u %6u.%02u\n", direction, dlcis_size,
+		 frame_data_size, dlci_buf_size, bytes_per_s / 1000000,
+		 (bytes_per_s / 1000) % 1000, frames_per_s, cycles_per_100_bytes / 100,
+		 cycles_per_100_bytes % 100);
+}
+
+static void benchmark_print_header(const char *direction)
+{
+	TC_PRINT("%s dlcis frame   buf      MB/s  frames/s  cycles/B\n", direction);
+}
+
+/* Receive frames carrying BENCHMARK_BYTES of data, spread evenly across DLCIs */
+static void benchmark_rx(uint8_t dlcis_size, uint16_t frame_data_size, uint16_t dlci_buf_size)
+{
+	struct modem_cmux_stats stats_before;
+	struct modem_cmux_stats stats_after;
+	timing_t start;
+	timing_t end;
+	uint16_t stream_len = 0;
+	uint32_t received = 0;
+	uint32_t stalls = 0;
+	uint32_t progress;
+	int ret;
+
+	benchmark_setup_cmux(dlcis_size, frame_data_size, dlci_buf_size);
+
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		stream_len += benchmark_encode_frame(&stream[stream_len], i + 1,
+						     BENCHMARK_FRAME_TYPE_UIH, payload,
+						     frame_data_size);
+	}
+
+	modem_cmux_get_stats(&cmux, &stats_before);
+
+	start = timing_counter_get();
+
+	while (received < BENCHMARK_BYTES) {
+		modem_backend_mock_put(&bus_mock, stream, stream_len);
+
+		do {
+			progress = 0;
+
+			for (uint8_t i = 0; i < dlcis_size; i++) {
+				ret = modem_pipe_receive(dlci_pipes[i], scratch, sizeof(scratch));
+
+				if (ret > 0) {
+					progress += ret;
+				}
+			}
+
+			if (progress == 0) {
+				k_yield();
+
+				stalls++;
+			}
+
+			received += progress;
+
+			zassert_true(stalls < BENCHMARK_STALLS_MAX, "RX stalled");
+		} while (progress == 0);
+
+		/* Discard flow control commands sent in response */
+		benchmark_drain_bus();
+	}
+
+	end = timing_counter_get();
+
+	modem_cmux_get_stats(&cmux, &stats_after);
+
+	benchmark_report("RX", dlcis_size, frame_data_size, dlci_buf_size, received,
+			 stats_after.rx_frames - stats_before.rx_frames,
+			 timing_cycles_get(&start, &end));
+
+	benchmark_teardown_cmux();
+}
+
+static bool benchmark_dlcis_transmit_empty(uint8_t dlcis_size)
+{
+	for (uint8_t i = 0; i < dlcis_size; i++) {
+		if (ring_buf_is_empty(&dlcis[i].transmit_rb) == false) {
+			return false;
+		}
+	}
+
+	return ring_buf_is_empty(&cmux.transmit_rb);
+}
+
+/* Transmit BENCHMARK_BYTES of data, spread evenly across DLCIs */
+static void benchmark_tx(uint8_t dlcis_size, uint16_t frame_data_size, uint16_t dlci_buf_size)
+{
+	struct modem_cmux_stats stats_before;
+	struct modem_cmux_stats stats_after;
+	timing_t start;
+	timing_t end;
+	uint32_t sent = 0;
+	uint32_t stalls = 0;
+	uint32_t progress;
+	int ret;
+
+	benchmark_setup_cmux(dlcis_size, frame_data_size, dlci_buf_size);
+
+	modem_cmux_get_stats(&cmux, &stats_before);
+
+	start = timing_counter_get();
+
+	while (sent < BENCHMARK_BYTES) {
+		progress = 0;
+
+		for (uint8_t i = 0; i < dlcis_size; i++) {
+			ret = modem_pipe_transmit(dlci_pipes[i], payload, frame_data_size);
+
+			if (ret > 0) {
+				progress += ret;
+			}
+		}
+
+		if (progress == 0) {
+			k_yield();
+
+			stalls++;
+		}
+
+		sent += progress;
+
+		zassert_true(stalls < BENCHMARK_STALLS_MAX, "TX stalled");
+
+		benchmark_drain_bus();
+	}
+
+	/* Wait for queued data to be framed and transmitted */
+	while (benchmark_dlcis_transmit_empty(dlcis_size) == false) {
+		k_yield();
+
+		benchmark_drain_bus();
+
+		zassert_true(++stalls < BENCHMARK_STALLS_MAX, "TX stalled");
+	}
+
+	end = timing_counter_get();
+
+	modem_cmux_get_stats(&cmux, &stats_after);
+
+	benchmark_report("TX", dlcis_size, frame_data_size, dlci_buf_size, sent,
+			 stats_after.tx_frames - stats_before.tx_frames,
+			 timing_cycles_get(&start, &end));
+
+	benchmark_teardown_cmux();
+}
+
+static void benchmark_setup_instance(struct benchmark_instance *instance, uint16_t receive_budget)
+{
+	struct modem_backend_mock_transaction transaction_sabm;
+	uint8_t sabm_cmd[8];
+	uint8_t sabm_ack[8];
+
+	const struct modem_cmux_config cmux_config = {
+		.receive_buf = instance->receive_buf,
+		.receive_buf_size = sizeof(instance->receive_buf),
+		.transmit_buf = instance->transmit_buf,
+		.transmit_buf_size = sizeof(instance->transmit_buf),
+		.executor = &benchmark_executor,
+		.receive_budget = receive_budget,
+	};
+
+	const struct modem_cmux_dlci_config dlci_config = {
+		.dlci_address = 1,
+		.receive_buf = instance->dlci_receive_buf,
+		.receive_buf_size = sizeof(instance->dlci_receive_buf),
+		.transmit_buf = instance->dlci_transmit_buf,
+		.transmit_buf_size = sizeof(instance->dlci_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = instance->bus_mock_rx_buf,
+		.rx_buf_size = sizeof(instance->bus_mock_rx_buf),
+		.tx_buf = instance->bus_mock_tx_buf,
+		.tx_buf_size = sizeof(instance->bus_mock_tx_buf),
+		.limit = sizeof(instance->bus_mock_rx_buf),
+	};
+
+	modem_cmux_init(&instance->cmux, &cmux_config);
+
+	instance->dlci_pipe = modem_cmux_dlci_init(&instance->cmux, &instance->dlci, &dlci_config);
+	instance->bus_mock_pipe = modem_backend_mock_init(&instance->bus_mock, &bus_mock_config);
+
+	zassert_true(modem_pipe_open(instance->bus_mock_pipe) == 0, "Failed to open bus");
+	zassert_true(modem_cmux_attach(&instance->cmux, instance->bus_mock_pipe) == 0,
+		     "Failed to attach CMUX");
+
+	for (uint8_t dlci_address = 0; dlci_address < 2; dlci_address++) {
+		transaction_sabm.get = sabm_cmd;
+		transaction_sabm.get_size = benchmark_encode_frame(sabm_cmd, dlci_address,
+								   BENCHMARK_FRAME_TYPE_SABM,
+								   NULL, 0);
+		transaction_sabm.put = sabm_ack;
+		transaction_sabm.put_size = benchmark_encode_frame(sabm_ack, dlci_address,
+								   BENCHMARK_FRAME_TYPE_UA,
+								   NULL, 0);
+
+		modem_backend_mock_prime(&instance->bus_mock, &transaction_sabm);
+
+		if (dlci_address == 0) {
+			zassert_true(modem_cmux_connect(&instance->cmux) == 0,
+				     "Failed to connect CMUX");
+		} else {
+			zassert_true(modem_pipe_open(instance->dlci_pipe) == 0,
+				     "Failed to open DLCI");
+		}
+	}
+
+	modem_pipe_attach(instance->dlci_pipe, benchmark_instance_pipe_callback, instance);
+
+	instance->received = 0;
+	instance->finished = false;
+}
+
+/* Receive BENCHMARK_INSTANCE_BYTES on each of several CMUX instances sharing executor */
+static void benchmark_executor_rx(uint8_t instances_size, uint16_t receive_budget)
+{
+	timing_t start;
+	timing_t first;
+	timing_t last;
+	uint64_t cycles;
+	uint32_t bytes = instances_size * BENCHMARK_INSTANCE_BYTES;
+	uint32_t bytes_per_s;
+	uint32_t cycles_per_100_bytes;
+	uint32_t spread;
+
+	k_sem_reset(&instances_finished_sem);
+
+	for (uint8_t i = 0; i < instances_size; i++) {
+		benchmark_setup_instance(&instances[i], receive_budget);
+	}
+
+	/* Let all instances become ready before the executor serves any of them */
+	k_sched_lock();
+
+	start = timing_counter_get();
+
+	for (uint8_t i = 0; i < instances_size; i++) {
+		modem_backend_mock_put(&instances[i].bus_mock, instance_stream,
+				       sizeof(instance_stream));
+	}
+
+	k_sched_unlock();
+
+	for (uint8_t i = 0; i < instances_size; i++) {
+		zassert_true(k_sem_take(&instances_finished_sem, K_SECONDS(10)) == 0,
+			     "RX stalled");
+	}
+
+	first = instances[0].finish;
+	last = instances[0].finish;
+
+	for (uint8_t i = 1; i < instances_size; i++) {
+		first = (instances[i].finish < first) ? instances[i].finish : first;
+		last = (instances[i].finish > last) ? instances[i].finish : last;
+	}
+
+	cycles = timing_cycles_get(&start, &last);
+
+	bytes_per_s = (uint32_t)(((uint64_t)bytes * NSEC_PER_SEC) /
+				 MAX(timing_cycles_to_ns(cycles), 1));
+	cycles_per_100_bytes = (uint32_t)((cycles * 100) / bytes);
+	spread = (uint32_t)((timing_cycles_get(&first, &last) * 100) / MAX(cycles, 1));
+
+	TC_PRINT("EX %9u %6u %5u.%03u %6u.%02u %7u\n", instances_size, receive_budget,
+		 bytes_per_s / 1000000, (bytes_per_s / 1000) % 1000, cycles_per_100_bytes / 100,
+		 cycles_per_100_bytes % 100, spread);
+
+	for (uint8_t i = 0; i < instances_size; i++) {
+		modem_cmux_release(&instances[i].cmux);
+	}
+}
+
+static void benchmark_sweep(void (*benchmark)(uint8_t, uint16_t, uint16_t))
+{
+	uint16_t frame_data_size;
+	uint16_t dlci_buf_size;
+
+	for (size_t i = 0; i < ARRAY_SIZE(benchmark_dlci_counts); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(benchmark_frame_data_sizes); j++) {
+			for (size_t k = 0; k < ARRAY_SIZE(benchmark_dlci_buf_sizes); k++) {
+				frame_data_size = benchmark_frame_data_sizes[j];
+				dlci_buf_size = benchmark_dlci_buf_sizes[k];
+
+				/* DLCI buffer must fit frame */
+				if (dlci_buf_size < frame_data_size) {
+					continue;
+				}
+
+				benchmark(benchmark_dlci_counts[i], frame_data_size,
+					  dlci_buf_size);
+			}
+		}
+	}
+}
+
+static void *benchmark_setup(void)
+{
+	uint16_t stream_len = 0;
+
+	for (uint16_t i = 0; i < sizeof(payload); i++) {
+		payload[i] = i;
+	}
+
+	for (uint16_t i = 0; i < BENCHMARK_INSTANCE_FRAMES; i++) {
+		stream_len += benchmark_encode_frame(&instance_stream[stream_len], 1,
+						     BENCHMARK_FRAME_TYPE_UIH, payload,
+						     BENCHMARK_INSTANCE_DATA_SIZE);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+static void benchmark_teardown(void *f)
+{
+	timing_stop();
+}
+
+ZTEST(modem_cmux_benchmark, modem_cmux_benchmark_rx)
+{
+	benchmark_print_header("RX");
+	benchmark_sweep(benchmark_rx);
+}
+
+ZTEST(modem_cmux_benchmark, modem_cmux_benchmark_tx)
+{
+	benchmark_print_header("TX");
+	benchmark_sweep(benchmark_tx);
+}
+
+ZTEST(modem_cmux_benchmark, modem_cmux_benchmark_executor)
+{
+	TC_PRINT("EX instances budget      MB/s  cycles/B spread%%\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(benchmark_instance_counts); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(benchmark_receive_budgets); j++) {
+			benchmark_executor_rx(benchmark_instance_counts[i],
+					      benchmark_receive_budgets[j]);
+		}
+	}
+}
+
+ZTEST_SUITE(modem_cmux_benchmark, NULL, benchmark_setup, NULL, NULL, benchmark_teardown);
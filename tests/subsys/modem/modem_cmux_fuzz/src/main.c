@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) 2023 Trackunit Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Fuzz harness for the CMUX receive path. Every input is received by a freshly connected
+ * CMUX instance using the basic option and one using the advanced option, each with DLCI1
+ * open. The cost of processing an input is measured in cycles per byte, and compared to the
+ * cost of receiving well-formed frames carrying data to DLCI1, measured once at startup.
+ * Inputs costing more than FUZZ_COST_FACTOR_MAX times the baseline are flagged.
+ *
+ * Built as is, the inputs in the corpus directory are replayed as a regression test:
+ *
+ *     west build -b native_posix tests/subsys/modem/modem_cmux_fuzz -t run
+ *
+ * Built with fuzz.conf, the harness is linked with libFuzzer, and flagged inputs abort the
+ * fuzzer, which saves them as crash-<sha1>. Copy these to the corpus directory to add them
+ * to the regression test:
+ *
+ *     west build -b native_posix_64 tests/subsys/modem/modem_cmux_fuzz -- \
+ *         -DZEPHYR_TOOLCHAIN_VARIANT=llvm -DOVERLAY_CONFIG=fuzz.conf
+ *     mkdir -p work && ./build/zephyr/zephyr.exe work tests/subsys/modem/modem_cmux_fuzz/corpus
+ */
+
+/*************************************************************************************************/
+/*                                        Dependencies                                           */
+/*************************************************************************************************/
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/timing/timing.h>
+#include <string.h>
+
+#if defined(CONFIG_ARCH_POSIX_LIBFUZZER)
+#include <zephyr/irq.h>
+#else
+#include <zephyr/ztest.h>
+#endif
+
+#include <zephyr/modem/cmux.h>
+#include <modem_backend_mock.h>
+
+/*************************************************************************************************/
+/*                                         Definitions                                           */
+/*************************************************************************************************/
+#define FUZZ_CHUNK_SIZE			(256)
+#define FUZZ_RECEIVE_BUF_SIZE		(128)
+#define FUZZ_COST_BYTES_MIN		(256)
+#define FUZZ_COST_FACTOR_MAX		(8)
+#define FUZZ_BASELINE_FRAMES		(32)
+#define FUZZ_BASELINE_DATA_SIZE		(127)
+#define FUZZ_FRAME_SIZE_MAX		(2 * FUZZ_BASELINE_DATA_SIZE + 10)
+
+#define FUZZ_FRAME_TYPE_SABM		(0x3F)
+#define FUZZ_FRAME_TYPE_UA		(0x73)
+#define FUZZ_FRAME_TYPE_UIH		(0xEF)
+
+#define FUZZ_ADVANCED_FLAG		(0x7E)
+#define FUZZ_ADVANCED_ESCAPE		(0x7D)
+#define FUZZ_ADVANCED_ESCAPE_MASK	(0x20)
+
+/*************************************************************************************************/
+/*                                          Instances                                            */
+/*************************************************************************************************/
+struct fuzz_instance {
+	const char *name;
+	enum modem_cmux_option option;
+	struct modem_cmux cmux;
+	uint8_t *receive_buf;
+	uint8_t transmit_buf[256];
+	struct modem_cmux_dlci dlci;
+	struct modem_pipe *dlci_pipe;
+	uint8_t dlci_receive_buf[256];
+	uint8_t dlci_transmit_buf[128];
+	struct modem_backend_mock bus_mock;
+	uint8_t bus_mock_rx_buf[FUZZ_CHUNK_SIZE];
+	uint8_t bus_mock_tx_buf[4096];
+	struct modem_pipe *bus_mock_pipe;
+	/* Cost of receiving well-formed frames in cycles per 100 bytes */
+	uint32_t baseline;
+};
+
+/* Receive buffers are kept apart from instances so reads past them are caught by sanitizers */
+static uint8_t basic_receive_buf[FUZZ_RECEIVE_BUF_SIZE];
+static uint8_t advanced_receive_buf[FUZZ_RECEIVE_BUF_SIZE];
+
+static struct fuzz_instance instances[] = {
+	{
+		.name = "basic",
+		.option = MODEM_CMUX_OPTION_BASIC,
+		.receive_buf = basic_receive_buf,
+	},
+	{
+		.name = "advanced",
+		.option = MODEM_CMUX_OPTION_ADVANCED,
+		.receive_buf = advanced_receive_buf,
+	},
+};
+
+static uint8_t baseline_stream[FUZZ_BASELINE_FRAMES * FUZZ_FRAME_SIZE_MAX];
+static uint8_t scratch[512];
+
+/*************************************************************************************************/
+/*                                          Callbacks                                            */
+/*************************************************************************************************/
+/* Drain DLCI in work queue context, as fast as data is received */
+static void fuzz_dlci_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_event event,
+				    void *user_data)
+{
+	if (event != MODEM_PIPE_EVENT_RECEIVE_READY) {
+		return;
+	}
+
+	while (modem_pipe_receive(pipe, scratch, sizeof(scratch)) > 0) {
+	}
+}
+
+/*************************************************************************************************/
+/*                                          Helpers                                              */
+/*************************************************************************************************/
+static void fuzz_put_escaped(uint8_t *buf, uint16_t *i, uint8_t byte)
+{
+	if ((byte == FUZZ_ADVANCED_FLAG) || (byte == FUZZ_ADVANCED_ESCAPE)) {
+		buf[(*i)++] = FUZZ_ADVANCED_ESCAPE;
+		byte ^= FUZZ_ADVANCED_ESCAPE_MASK;
+	}
+
+	buf[(*i)++] = byte;
+}
+
+/* Encode frame sent by the remote in advanced option */
+static uint16_t fuzz_encode_frame_advanced(uint8_t *buf, uint8_t dlci_address, uint8_t type,
+					   const uint8_t *data, uint16_t data_len)
+{
+	uint8_t header[2] = {0x03 | (dlci_address << 2), type};
+	uint16_t i = 0;
+	uint8_t fcs;
+
+	fcs = crc8(header, sizeof(header), 0xE0, 0xFF, true);
+
+	if (type != FUZZ_FRAME_TYPE_UIH) {
+		fcs = crc8(data, data_len, 0xE0, fcs, true);
+	}
+
+	buf[i++] = FUZZ_ADVANCED_FLAG;
+	fuzz_put_escaped(buf, &i, header[0]);
+	fuzz_put_escaped(buf, &i, header[1]);
+
+	for (uint16_t j = 0; j < data_len; j++) {
+		fuzz_put_escaped(buf, &i, data[j]);
+	}
+
+	fuzz_put_escaped(buf, &i, 0xFF - fcs);
+	buf[i++] = FUZZ_ADVANCED_FLAG;
+
+	return i;
+}
+
+/* Encode frame sent by the remote in basic option */
+static uint16_t fuzz_encode_frame_basic(uint8_t *buf, uint8_t dlci_address, uint8_t type,
+					const uint8_t *data, uint16_t data_len)
+{
+	uint16_t header_len;
+	uint16_t i = 0;
+	uint8_t fcs;
+
+	buf[i++] = 0xF9;
+	buf[i++] = 0x03 | (dlci_address << 2);
+	buf[i++] = type;
+
+	if (data_len < 128) {
+		buf[i++] = (data_len << 1) | 0x01;
+	} else {
+		buf[i++] = (data_len & 0x7F) << 1;
+		buf[i++] = data_len >> 7;
+	}
+
+	header_len = i - 1;
+
+	fcs = crc8(&buf[1], header_len, 0xE0, 0xFF, true);
+
+	if (type != FUZZ_FRAME_TYPE_UIH) {
+		fcs = crc8(data, data_len, 0xE0, fcs, true);
+	}
+
+	if (data_len > 0) {
+		memcpy(&buf[i], data, data_len);
+		i += data_len;
+	}
+
+	buf[i++] = 0xFF - fcs;
+	buf[i++] = 0xF9;
+
+	return i;
+}
+
+static uint16_t fuzz_encode_frame(struct fuzz_instance *instance, uint8_t *buf,
+				  uint8_t dlci_address, uint8_t type, const uint8_t *data,
+				  uint16_t data_len)
+{
+	if (instance->option == MODEM_CMUX_OPTION_ADVANCED) {
+		return fuzz_encode_frame_advanced(buf, dlci_address, type, data, data_len);
+	}
+
+	return fuzz_encode_frame_basic(buf, dlci_address, type, data, data_len);
+}
+
+static void fuzz_drain_bus(struct fuzz_instance *instance)
+{
+	while (modem_backend_mock_get(&instance->bus_mock, scratch, sizeof(scratch)) > 0) {
+	}
+}
+
+/* Connect CMUX or open DLCI, answering the SABM frame it sends */
+static int fuzz_open(struct fuzz_instance *instance, uint8_t dlci_address)
+{
+	struct modem_backend_mock_transaction transaction_sabm;
+	uint8_t sabm_cmd[8];
+	uint8_t sabm_ack[8];
+
+	transaction_sabm.get = sabm_cmd;
+	transaction_sabm.get_size = fuzz_encode_frame(instance, sabm_cmd, dlci_address,
+						      FUZZ_FRAME_TYPE_SABM, NULL, 0);
+	transaction_sabm.put = sabm_ack;
+	transaction_sabm.put_size = fuzz_encode_frame(instance, sabm_ack, dlci_address,
+						      FUZZ_FRAME_TYPE_UA, NULL, 0);
+
+	modem_backend_mock_prime(&instance->bus_mock, &transaction_sabm);
+
+	/* Transaction references stack, so wait until it is answered */
+	if (dlci_address == 0) {
+		return modem_cmux_connect(&instance->cmux);
+	}
+
+	return modem_pipe_open(instance->dlci_pipe);
+}
+
+static int fuzz_setup(struct fuzz_instance *instance)
+{
+	int ret;
+
+	const struct modem_cmux_config cmux_config = {
+		.option = instance->option,
+		.receive_buf = instance->receive_buf,
+		.receive_buf_size = FUZZ_RECEIVE_BUF_SIZE,
+		.transmit_buf = instance->transmit_buf,
+		.transmit_buf_size = sizeof(instance->transmit_buf),
+	};
+
+	const struct modem_cmux_dlci_config dlci_config = {
+		.dlci_address = 1,
+		.receive_buf = instance->dlci_receive_buf,
+		.receive_buf_size = sizeof(instance->dlci_receive_buf),
+		.transmit_buf = instance->dlci_transmit_buf,
+		.transmit_buf_size = sizeof(instance->dlci_transmit_buf),
+	};
+
+	const struct modem_backend_mock_config bus_mock_config = {
+		.rx_buf = instance->bus_mock_rx_buf,
+		.rx_buf_size = sizeof(instance->bus_mock_rx_buf),
+		.tx_buf = instance->bus_mock_tx_buf,
+		.tx_buf_size = sizeof(instance->bus_mock_tx_buf),
+		.limit = sizeof(instance->bus_mock_tx_buf),
+	};
+
+	modem_cmux_init(&instance->cmux, &cmux_config);
+
+	instance->dlci_pipe = modem_cmux_dlci_init(&instance->cmux, &instance->dlci,
+						   &dlci_config);
+
+	instance->bus_mock_pipe = modem_backend_mock_init(&instance->bus_mock, &bus_mock_config);
+
+	ret = modem_pipe_open(instance->bus_mock_pipe);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = modem_cmux_attach(&instance->cmux, instance->bus_mock_pipe);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fuzz_open(instance, 0);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	modem_pipe_attach(instance->dlci_pipe, fuzz_dlci_pipe_callback, instance);
+
+	ret = fuzz_open(instance, 1);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	fuzz_drain_bus(instance);
+
+	return 0;
+}
+
+static void fuzz_teardown(struct fuzz_instance *instance)
+{
+	modem_cmux_release(&instance->cmux);
+}
+
+/* Receive data in chunks, returning the cycles spent processing them */
+static uint64_t fuzz_receive(struct fuzz_instance *instance, const uint8_t *data, size_t size)
+{
+	uint64_t cycles = 0;
+	timing_t start;
+	timing_t end;
+	size_t chunk;
+
+	while (size > 0) {
+		chunk = MIN(size, FUZZ_CHUNK_SIZE);
+
+		start = timing_counter_get();
+
+		modem_backend_mock_put(&instance->bus_mock, data, chunk);
+
+		/* Yield to work queue until chunk is processed */
+		while ((ring_buf_is_empty(&instance->bus_mock.rx_rb) == false) ||
+		       (k_work_delayable_busy_get(&instance->cmux.receive_work.dwork) != 0)) {
+			k_yield();
+		}
+
+		end = timing_counter_get();
+
+		cycles += timing_cycles_get(&start, &end);
+
+		/* Responses to chunk are bounded by its size, keep them from piling up */
+		fuzz_drain_bus(instance);
+
+		data += chunk;
+		size -= chunk;
+	}
+
+	return cycles;
+}
+
+static uint32_t fuzz_cost(uint64_t cycles, size_t size)
+{
+	return (uint32_t)((cycles * 100) / size);
+}
+
+/* Cost is only meaningful once it is not dominated by the overhead of a few chunks */
+static bool fuzz_cost_exceeded(struct fuzz_instance *instance, size_t size, uint32_t cost)
+{
+	if ((size < FUZZ_COST_BYTES_MIN) || (instance->baseline == 0)) {
+		return false;
+	}
+
+	return cost > (instance->baseline * FUZZ_COST_FACTOR_MAX);
+}
+
+static int fuzz_measure_baseline(struct fuzz_instance *instance)
+{
+	uint8_t payload[FUZZ_BASELINE_DATA_SIZE];
+	size_t stream_len = 0;
+	uint64_t cycles;
+	int ret;
+
+	for (uint16_t i = 0; i < sizeof(payload); i++) {
+		payload[i] = 'A' + (i % 26);
+	}
+
+	for (uint16_t i = 0; i < FUZZ_BASELINE_FRAMES; i++) {
+		stream_len += fuzz_encode_frame(instance, &baseline_stream[stream_len], 1,
+						FUZZ_FRAME_TYPE_UIH, payload, sizeof(payload));
+	}
+
+	ret = fuzz_setup(instance);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	cycles = fuzz_receive(instance, baseline_stream, stream_len);
+
+	fuzz_teardown(instance);
+
+	instance->baseline = fuzz_cost(cycles, stream_len);
+
+	return 0;
+}
+
+static int fuzz_init(void)
+{
+	int ret;
+
+	timing_init();
+	timing_start();
+
+	for (size_t i = 0; i < ARRAY_SIZE(instances); i++) {
+		ret = fuzz_measure_baseline(&instances[i]);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+/* Receive input on a fresh instance, returning its cost in cycles per 100 bytes */
+static int fuzz_run(struct fuzz_instance *instance, const uint8_t *data, size_t size,
+		    uint32_t *cost)
+{
+	uint64_t cycles;
+	int ret;
+
+	ret = fuzz_setup(instance);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	cycles = fuzz_receive(instance, data, size);
+
+	fuzz_teardown(instance);
+
+	*cost = (size == 0) ? 0 : fuzz_cost(cycles, size);
+
+	return 0;
+}
+
+#if defined(CONFIG_ARCH_POSIX_LIBFUZZER)
+/*************************************************************************************************/
+/*                                           Fuzzer                                              */
+/*************************************************************************************************/
+extern const uint8_t *posix_fuzz_buf;
+extern size_t posix_fuzz_sz;
+
+static K_SEM_DEFINE(fuzz_sem, 0, K_SEM_MAX_LIMIT);
+
+static void fuzz_isr(const void *arg)
+{
+	/* Process input in thread context, where the CMUX work queue can be yielded to */
+	k_sem_give(&fuzz_sem);
+}
+
+int main(void)
+{
+	uint32_t cost;
+
+	if (fuzz_init() < 0) {
+		printk("Failed to measure baseline\n");
+		k_panic();
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(instances); i++) {
+		printk("%s baseline %u.%02u cycles/B\n", instances[i].name,
+		       instances[i].baseline / 100, instances[i].baseline % 100);
+	}
+
+	IRQ_CONNECT(CONFIG_ARCH_POSIX_FUZZ_IRQ, 0, fuzz_isr, NULL, 0);
+	irq_enable(CONFIG_ARCH_POSIX_FUZZ_IRQ);
+
+	while (true) {
+		k_sem_take(&fuzz_sem, K_FOREVER);
+
+		for (size_t i = 0; i < ARRAY_SIZE(instances); i++) {
+			if (fuzz_run(&instances[i], posix_fuzz_buf, posix_fuzz_sz, &cost) < 0) {
+				printk("%s failed to connect\n", instances[i].name);
+				k_panic();
+			}
+
+			/* Abort to have the fuzzer save the input */
+			if (fuzz_cost_exceeded(&instances[i], posix_fuzz_sz, cost)) {
+				printk("%s input of %zu bytes costs %u.%02u cycles/B\n",
+				       instances[i].name, posix_fuzz_sz, cost / 100, cost % 100);
+				k_panic();
+			}
+		}
+	}
+
+	return 0;
+}
+#else
+/*************************************************************************************************/
+/*                                      Regression corpus                                        */
+/*************************************************************************************************/
+struct corpus_entry {
+	const char *name;
+	const uint8_t *data;
+	size_t size;
+};
+
+/* Generated from the files in the corpus directory */
+#include <corpus.h>
+
+/*************************************************************************************************/
+/*                                         Test setup                                            */
+/*************************************************************************************************/
+static void *test_modem_cmux_fuzz_setup(void)
+{
+	__ASSERT_NO_MSG(fuzz_init() == 0);
+
+	return NULL;
+}
+
+/*************************************************************************************************/
+/*                                            Tests                                              */
+/*************************************************************************************************/
+ZTEST(modem_cmux_fuzz, test_modem_cmux_fuzz_corpus)
+{
+	struct fuzz_instance *instance;
+	uint32_t cost;
+
+	TC_PRINT("option    bytes  cycles/B  baseline  input\n");
+
+	for (size_t i = 0; i < ARRAY_SIZE(corpus); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(instances); j++) {
+			instance = &instances[j];
+
+			zassert_ok(fuzz_run(instance, corpus[i].data, corpus[i].size, &cost),
+				   "Failed to connect %s instance", instance->name);
+
+			TC_PRINT("%-8s %6zu %6u.%02u %6u.%02u  %s\n", instance->name,
+				 corpus[i].size, cost / 100, cost % 100, instance->baseline / 100,
+				 instance->baseline % 100, corpus[i].name);
+
+			zassert_false(fuzz_cost_exceeded(instance, corpus[i].size, cost),
+				      "%s exceeds cost threshold", corpus[i].name);
+		}
+	}
+}
+
+ZTEST_SUITE(modem_cmux_fuzz, NULL, test_modem_cmux_fuzz_setup, NULL, NULL, NULL);
+#endif